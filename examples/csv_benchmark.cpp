@@ -79,7 +79,7 @@ int main(int argc, char* argv[]) {
         std::cout << "\n=== Amostra de Dados (primeiras " << sampleSize << " linhas) ===" << std::endl;
         
         for (size_t i = 0; i < sampleSize; ++i) {
-            auto row = csv.getRow(i);
+            auto row = csv.rowView(i);
             for (const auto& item : row) {
                 std::cout << item << " | ";
             }
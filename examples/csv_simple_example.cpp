@@ -33,7 +33,7 @@ int main() {
     // Mostrar todos os dados
     std::cout << "Data:" << std::endl;
     for (size_t i = 0; i < csv.rowCount(); ++i) {
-        auto row = csv.getRow(i);
+        auto row = csv.rowView(i);
         for (const auto& item : row) {
             std::cout << item << "\t";
         }
@@ -42,7 +42,7 @@ int main() {
     
     // Obter uma coluna específica
     std::cout << "Names: ";
-    auto names = csv.getColumn("Name");
+    auto names = csv.columnView("Name");
     for (const auto& name : names) {
         std::cout << name << " ";
     }
@@ -8,7 +8,6 @@ int main(int argc, char* argv[]) {
     }
 
     std::string filename = argv[1];
-    auto df = CPPandas::CPPandas::read_csv(filename);
 
     // Selecionar colunas específicas
     std::vector<std::string> columns = {
@@ -19,8 +18,10 @@ int main(int argc, char* argv[]) {
     };
 
     try {
-        // Selecionar colunas e remover linhas com valores NaN
-        auto df_selection = df[columns];
+        // Ler apenas as colunas selecionadas e remover linhas com valores NaN
+        CPPandas::ReadOptions options;
+        options.usecols = columns;
+        auto df_selection = CPPandas::CPPandas::read_csv(filename, options);
         df_selection = df_selection.dropna();
 
         // Exibir informações do DataFrame
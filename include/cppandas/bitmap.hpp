@@ -0,0 +1,215 @@
+/**
+ * @file bitmap.hpp
+ * @brief Mapa de bits compacto usado para validade de valores e máscaras de linhas
+ * @author CPPandas Team
+ */
+
+#ifndef CPPANDAS_BITMAP_HPP
+#define CPPANDAS_BITMAP_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace CPPandas {
+
+/**
+ * @class Bitmap
+ * @brief Sequência de bits armazenada em palavras de 64 bits
+ *
+ * O bit i corresponde à linha i. Operações entre mapas (AND, OR, NOT) e a
+ * contagem de bits processam 64 linhas por instrução. Os bits além de
+ * size() na última palavra são mantidos sempre em zero, de modo que
+ * count() e as operações entre palavras não precisam de tratamento especial.
+ *
+ * Exemplo:
+ * @code
+ * Bitmap keep = df.column("pH").validity();
+ * keep &= df.column("Salinity").validity();
+ * std::vector<size_t> rows = keep.setBits();
+ * @endcode
+ */
+class Bitmap {
+public:
+    /**
+     * @brief Construtor padrão (mapa vazio)
+     */
+    Bitmap() = default;
+
+    /**
+     * @brief Cria um mapa com todos os bits iguais
+     * @param size Número de bits
+     * @param value Valor inicial dos bits
+     */
+    explicit Bitmap(size_t size, bool value = false)
+        : m_words(wordCount(size), value ? ~uint64_t(0) : 0), m_size(size) {
+        clearTail();
+    }
+
+    /**
+     * @brief Obtém o número de bits
+     * @return Número de bits
+     */
+    size_t size() const { return m_size; }
+
+    /**
+     * @brief Verifica se o mapa não tem bits
+     * @return true se size() == 0
+     */
+    bool empty() const { return m_size == 0; }
+
+    /**
+     * @brief Lê um bit
+     * @param index Posição do bit (0-based, não verificada)
+     * @return Valor do bit
+     */
+    bool test(size_t index) const { return (m_words[index / 64] >> (index % 64)) & 1; }
+
+    /**
+     * @brief Define um bit
+     * @param index Posição do bit (0-based, não verificada)
+     * @param value Novo valor
+     */
+    void set(size_t index, bool value = true) {
+        uint64_t bit = uint64_t(1) << (index % 64);
+        m_words[index / 64] = value ? (m_words[index / 64] | bit) : (m_words[index / 64] & ~bit);
+    }
+
+    /**
+     * @brief Define uma palavra inteira (64 bits a partir de 64 * wordIndex)
+     * @param wordIndex Índice da palavra
+     * @param word Bits da palavra; bits além de size() são descartados
+     */
+    void setWord(size_t wordIndex, uint64_t word) {
+        m_words[wordIndex] = word;
+        if (wordIndex + 1 == m_words.size()) {
+            clearTail();
+        }
+    }
+
+    /**
+     * @brief Conta os bits definidos
+     * @return Número de bits iguais a 1
+     */
+    size_t count() const {
+        size_t total = 0;
+        for (uint64_t word : m_words) {
+            total += static_cast<size_t>(std::popcount(word));
+        }
+        return total;
+    }
+
+    /**
+     * @brief Verifica se todos os bits estão definidos
+     * @return true se count() == size()
+     */
+    bool all() const { return count() == m_size; }
+
+    /**
+     * @brief Verifica se nenhum bit está definido
+     * @return true se count() == 0
+     */
+    bool none() const {
+        for (uint64_t word : m_words) {
+            if (word != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Obtém as palavras do mapa
+     * @return Palavras de 64 bits, com os bits excedentes em zero
+     */
+    std::span<const uint64_t> words() const { return m_words; }
+
+    /**
+     * @brief Obtém as posições dos bits definidos, em ordem crescente
+     * @return Posições dos bits iguais a 1
+     */
+    std::vector<size_t> setBits() const {
+        std::vector<size_t> positions;
+        positions.reserve(count());
+        for (size_t w = 0; w < m_words.size(); ++w) {
+            uint64_t word = m_words[w];
+            while (word != 0) {
+                positions.push_back(w * 64 + static_cast<size_t>(std::countr_zero(word)));
+                word &= word - 1;
+            }
+        }
+        return positions;
+    }
+
+    /**
+     * @brief Interseção com outro mapa de mesmo tamanho
+     * @throws std::invalid_argument se os tamanhos forem diferentes
+     */
+    Bitmap& operator&=(const Bitmap& other) {
+        checkSize(other);
+        for (size_t w = 0; w < m_words.size(); ++w) {
+            m_words[w] &= other.m_words[w];
+        }
+        return *this;
+    }
+
+    /**
+     * @brief União com outro mapa de mesmo tamanho
+     * @throws std::invalid_argument se os tamanhos forem diferentes
+     */
+    Bitmap& operator|=(const Bitmap& other) {
+        checkSize(other);
+        for (size_t w = 0; w < m_words.size(); ++w) {
+            m_words[w] |= other.m_words[w];
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Inverte todos os bits
+     * @return Referência para este mapa
+     */
+    Bitmap& flip() {
+        for (uint64_t& word : m_words) {
+            word = ~word;
+        }
+        clearTail();
+        return *this;
+    }
+
+    friend Bitmap operator&(Bitmap left, const Bitmap& right) { return left &= right; }
+    friend Bitmap operator|(Bitmap left, const Bitmap& right) { return left |= right; }
+    friend Bitmap operator~(Bitmap bitmap) { return bitmap.flip(); }
+
+    bool operator==(const Bitmap& other) const = default;
+
+    /**
+     * @brief Número de palavras necessárias para um número de bits
+     * @param size Número de bits
+     * @return Número de palavras de 64 bits
+     */
+    static size_t wordCount(size_t size) { return (size + 63) / 64; }
+
+private:
+    void clearTail() {
+        if (m_size % 64 != 0) {
+            m_words.back() &= (uint64_t(1) << (m_size % 64)) - 1;
+        }
+    }
+
+    void checkSize(const Bitmap& other) const {
+        if (other.m_size != m_size) {
+            throw std::invalid_argument("Bitmap sizes differ");
+        }
+    }
+
+    std::vector<uint64_t> m_words;  ///< Bits, 64 por palavra
+    size_t m_size = 0;              ///< Número de bits
+};
+
+} // namespace CPPandas
+
+#endif // CPPANDAS_BITMAP_HPP
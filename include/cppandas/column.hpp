@@ -0,0 +1,909 @@
+/**
+ * @file column.hpp
+ * @brief Armazenamento colunar tipado usado internamente por CSV e DataFrame
+ * @author CPPandas Team
+ */
+
+#ifndef CPPANDAS_COLUMN_HPP
+#define CPPANDAS_COLUMN_HPP
+
+#include "cppandas/bitmap.hpp"
+#include "cppandas/compare.hpp"
+#include "cppandas/numeric.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CPPandas {
+
+/**
+ * @brief Tipos de dados suportados pelas colunas
+ */
+enum class DType {
+    Float64,  ///< Ponto flutuante de 64 bits (nulos representados por NaN)
+    Int64,    ///< Inteiro de 64 bits
+    Bool,     ///< Booleano armazenado em um byte por valor
+    Datetime, ///< Data/hora em nanossegundos desde 1970-01-01 (nulos representados por kNaT)
+    String,   ///< Texto (nulos representados por string vazia)
+    Category  ///< Texto codificado por dicionário (códigos uint8/16/32; nulos com código reservado)
+};
+
+/**
+ * @brief Valor nulo de colunas datetime (Not a Time)
+ */
+constexpr int64_t kNaT = INT64_MIN;
+
+
+/**
+ * @brief Obtém o nome de um tipo de dados no estilo do pandas
+ * @param dtype Tipo de dados
+ * @return Nome do tipo ("float64", "int64", "bool", "datetime64[ns]", "string" ou "category")
+ */
+const char* dtypeName(DType dtype);
+
+/**
+ * @brief Obtém um tipo de dados a partir do nome (como em astype() do pandas)
+ *
+ * Aceita os nomes de dtypeName() e os sinônimos "float", "int", "datetime",
+ * "str" e "object".
+ *
+ * @param name Nome do tipo
+ * @return Tipo de dados
+ * @throws std::invalid_argument se o nome não for reconhecido
+ */
+DType dtypeFromName(std::string_view name);
+
+/**
+ * @brief Verifica se um tipo de dados é numérico (float64, int64 ou bool)
+ * @param dtype Tipo de dados
+ * @return true se o tipo for numérico
+ */
+inline bool isNumericType(DType dtype) {
+    return dtype == DType::Float64 || dtype == DType::Int64 || dtype == DType::Bool;
+}
+
+/**
+ * @class ValueBuffer
+ * @brief Valores contíguos de uma coluna, compartilhados entre cópias (cópia na escrita)
+ *
+ * Os valores pertencem a um vetor próprio ou a uma memória externa (por
+ * exemplo, um arquivo mapeado em memória), mantida viva por um
+ * std::shared_ptr. Copiar o buffer não copia os valores: projeções,
+ * seleções e cópias de DataFrame compartilham a mesma memória, e os
+ * valores só são copiados quando um buffer compartilhado é modificado
+ * (mutableValues()).
+ *
+ * @tparam T Tipo dos valores
+ */
+template <typename T>
+class ValueBuffer {
+public:
+    /**
+     * @brief Construtor padrão (buffer vazio)
+     */
+    ValueBuffer() = default;
+
+    /**
+     * @brief Assume a posse de um vetor de valores
+     * @param values Valores
+     */
+    explicit ValueBuffer(std::vector<T> values) {
+        auto storage = std::make_shared<std::vector<T>>(std::move(values));
+        m_data = storage->data();
+        m_size = storage->size();
+        m_vector = storage.get();
+        m_owner = std::move(storage);
+    }
+
+    /**
+     * @brief Referencia valores em memória externa, sem cópia
+     * @param data Primeiro valor
+     * @param size Número de valores
+     * @param owner Dono da memória, mantido vivo enquanto o buffer existir
+     */
+    ValueBuffer(const T* data, size_t size, std::shared_ptr<const void> owner)
+        : m_data(data), m_size(size), m_owner(std::move(owner)) {}
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    const T& operator[](size_t index) const { return m_data[index]; }
+    const T* data() const { return m_data; }
+    const T* begin() const { return m_data; }
+    const T* end() const { return m_data + m_size; }
+    operator std::span<const T>() const { return {m_data, m_size}; }
+
+    /**
+     * @brief Verifica se os valores são compartilhados com outro buffer ou com memória externa
+     * @return true se mutableValues() precisaria copiar os valores
+     */
+    bool shared() const { return !m_vector || m_owner.use_count() != 1; }
+
+    /**
+     * @brief Obtém acesso de escrita aos valores
+     *
+     * Se os valores forem compartilhados (shared()), este buffer passa a
+     * ter uma cópia própria antes da escrita; as demais cópias continuam
+     * vendo os valores originais.
+     *
+     * @return Valores, graváveis enquanto o buffer não for copiado
+     */
+    std::span<T> mutableValues() {
+        if (shared()) {
+            *this = ValueBuffer(std::vector<T>(begin(), end()));
+        }
+        return {m_vector->data(), m_size};
+    }
+
+private:
+    const T* m_data = nullptr;            ///< Primeiro valor
+    size_t m_size = 0;                    ///< Número de valores
+    std::vector<T>* m_vector = nullptr;   ///< Vetor próprio (nullptr se a memória for externa)
+    std::shared_ptr<const void> m_owner;  ///< Dono da memória dos valores
+};
+
+/**
+ * @class ColumnBuffer
+ * @brief Coluna tipada com armazenamento contíguo
+ *
+ * Os valores são convertidos uma única vez na construção, de modo que as
+ * operações numéricas percorrem buffers contíguos em vez de reconverter
+ * strings a cada chamada.
+ */
+class ColumnBuffer {
+public:
+    /**
+     * @brief Construtor padrão (coluna de texto vazia)
+     */
+    ColumnBuffer() = default;
+
+    /**
+     * @brief Cria uma coluna inferindo o tipo a partir dos valores textuais
+     *
+     * A coluna é int64 se todos os valores forem inteiros, bool se todos
+     * forem booleanos, float64 se todos forem numéricos ou vazios,
+     * datetime se todos forem datas e string caso contrário.
+     *
+     * @param cells Valores textuais da coluna
+     * @return Coluna tipada
+     */
+    static ColumnBuffer fromStrings(std::vector<std::string> cells);
+
+    /**
+     * @brief Cria uma coluna inferindo o tipo a partir de campos não proprietários
+     *
+     * Se a coluna resultante for de texto e @p owner for fornecido, os
+     * campos são mantidos sem cópia e @p owner permanece vivo enquanto a
+     * coluna existir (por exemplo, um arquivo mapeado em memória). Sem
+     * @p owner, os campos de texto são copiados.
+     *
+     * Com @p sampleRows > 0, o tipo é inferido a partir de uma amostra de
+     * linhas espaçadas uniformemente; se algum valor fora da amostra não
+     * couber no tipo inferido, a coluna recebe o próximo tipo mais amplo
+     * (int64 -> float64 -> string, bool/datetime -> string).
+     *
+     * @param cells Campos textuais da coluna
+     * @param owner Dono da memória referenciada pelos campos (sem dono, o texto é copiado para uma arena da coluna)
+     * @param sampleRows Número de linhas examinadas na inferência (0 = todas)
+     * @return Coluna tipada
+     */
+    static ColumnBuffer fromViews(std::vector<std::string_view> cells,
+                                  std::shared_ptr<const void> owner = nullptr,
+                                  size_t sampleRows = 0);
+
+    /**
+     * @brief Cria uma coluna inferindo o tipo, no mínimo tão amplo quanto @p atLeast
+     *
+     * Usado na leitura em lotes: o tipo inferido é combinado com o tipo
+     * dos lotes anteriores (ver commonDType()) e, como na inferência,
+     * ampliado se algum valor não couber, de modo que nenhum valor é perdido.
+     *
+     * @param cells Campos textuais da coluna
+     * @param owner Dono da memória referenciada pelos campos (sem dono, o texto é copiado para uma arena da coluna)
+     * @param sampleRows Número de linhas examinadas na inferência (0 = todas)
+     * @param atLeast Tipo mínimo da coluna
+     * @return Coluna tipada
+     */
+    static ColumnBuffer fromViews(std::vector<std::string_view> cells, std::shared_ptr<const void> owner,
+                                  size_t sampleRows, DType atLeast);
+
+    /**
+     * @brief Cria uma coluna de um tipo definido, sem inferência
+     *
+     * Valores que não podem ser convertidos tornam-se nulos. Como int64 e
+     * bool não representam nulos, colunas com valores ausentes são
+     * promovidas (int64 -> float64, bool -> string).
+     *
+     * @param cells Campos textuais da coluna
+     * @param dtype Tipo de dados desejado
+     * @param owner Dono da memória referenciada pelos campos (sem dono, o texto é copiado para uma arena da coluna)
+     * @return Coluna tipada
+     */
+    static ColumnBuffer fromViews(std::vector<std::string_view> cells, DType dtype,
+                                  std::shared_ptr<const void> owner = nullptr);
+
+    /**
+     * @brief Infere o tipo de dados de uma coluna de texto
+     * @param cells Campos textuais da coluna
+     * @param sampleRows Número de linhas examinadas (0 = todas)
+     * @return Tipo de dados mais restrito que comporta os valores examinados
+     */
+    static DType inferDType(std::span<const std::string_view> cells, size_t sampleRows = 0);
+
+    /**
+     * @brief Obtém o tipo mais restrito que comporta valores de dois tipos
+     *
+     * int64 e float64 resultam em float64; tipos diferentes nos demais casos
+     * resultam em string.
+     *
+     * @param a Primeiro tipo
+     * @param b Segundo tipo
+     * @return Tipo comum
+     */
+    static DType commonDType(DType a, DType b);
+
+    /**
+     * @brief Cria uma coluna float64
+     * @param values Valores da coluna
+     * @return Coluna tipada
+     */
+    static ColumnBuffer fromFloat64(std::vector<double> values);
+
+    /**
+     * @brief Cria uma coluna int64
+     * @param values Valores da coluna
+     * @return Coluna tipada
+     */
+    static ColumnBuffer fromInt64(std::vector<int64_t> values);
+
+    /**
+     * @brief Cria uma coluna booleana
+     * @param values Valores da coluna (0 ou 1)
+     * @return Coluna tipada
+     */
+    static ColumnBuffer fromBool(std::vector<uint8_t> values);
+
+    /**
+     * @brief Cria uma coluna datetime
+     * @param values Nanossegundos desde 1970-01-01 (kNaT para nulos)
+     * @return Coluna tipada
+     */
+    static ColumnBuffer fromDatetime(std::vector<int64_t> values);
+
+    /**
+     * @brief Cria uma coluna de tamanho fixo sobre valores em memória externa, sem cópia
+     *
+     * Usado para abrir arquivos binários mapeados em memória: os valores só
+     * são lidos do disco quando acessados.
+     *
+     * @param dtype Tipo de dados (float64, int64, bool ou datetime)
+     * @param values Primeiro valor, alinhado ao tipo
+     * @param size Número de valores
+     * @param validity Mapa de validade com @p size bits
+     * @param owner Dono da memória dos valores
+     * @return Coluna tipada
+     * @throws std::invalid_argument se o tipo for string ou o mapa tiver outro tamanho
+     */
+    static ColumnBuffer fromExternal(DType dtype, const void* values, size_t size, Bitmap validity,
+                                     std::shared_ptr<const void> owner);
+
+    /**
+     * @brief Cria uma coluna categórica a partir do dicionário e dos códigos, sem cópia
+     *
+     * A largura dos códigos é a definida por categoryCodeWidth() para o
+     * tamanho do dicionário; o maior valor dessa largura indica nulo.
+     *
+     * @param categories Valores distintos, sem repetições nem valores vazios
+     * @param codes Primeiro código, alinhado à largura
+     * @param size Número de valores
+     * @param owner Dono da memória dos códigos e do texto das categorias
+     * @return Coluna categórica
+     */
+    static ColumnBuffer fromCodes(std::vector<std::string_view> categories, const void* codes, size_t size,
+                                  std::shared_ptr<const void> owner);
+
+    /**
+     * @brief Obtém a largura dos códigos de um dicionário
+     * @param categoryCount Número de categorias
+     * @return 1, 2 ou 4 bytes (o maior valor de cada largura é reservado para nulos)
+     */
+    static size_t categoryCodeWidth(size_t categoryCount) {
+        return categoryCount < UINT8_MAX ? 1 : categoryCount < UINT16_MAX ? 2 : 4;
+    }
+
+    /**
+     * @brief Código dos valores nulos em code()
+     */
+    static constexpr uint32_t kNullCode = UINT32_MAX;
+
+    /**
+     * @brief Converte a coluna para outro tipo
+     *
+     * A conversão para categoria monta o dicionário na ordem da primeira
+     * ocorrência de cada valor. As demais conversões passam pelo texto dos
+     * valores, com as regras da leitura: valores que não cabem no tipo
+     * tornam-se nulos (e int64/bool com nulos são promovidos).
+     *
+     * @param dtype Tipo desejado
+     * @return Nova coluna (os valores são compartilhados se o tipo não mudar)
+     */
+    ColumnBuffer astype(DType dtype) const;
+
+    /**
+     * @brief Cria uma coluna com um subconjunto das linhas, mantendo o tipo
+     *
+     * Colunas de texto compartilham o armazenamento da coluna original, sem
+     * copiar o conteúdo dos campos.
+     *
+     * @param indices Índices das linhas, na ordem desejada (podem se repetir)
+     * @return Nova coluna com os valores selecionados
+     * @throws std::out_of_range se algum índice for inválido
+     */
+    ColumnBuffer take(std::span<const size_t> indices) const;
+
+    /**
+     * @brief Obtém o tipo de dados da coluna
+     * @return Tipo de dados
+     */
+    DType dtype() const { return m_dtype; }
+
+    /**
+     * @brief Obtém o número de valores da coluna
+     * @return Número de valores
+     */
+    size_t size() const;
+
+    /**
+     * @brief Verifica se a coluna é numérica (float64, int64 ou bool)
+     * @return true se a coluna for numérica
+     */
+    bool isNumeric() const { return isNumericType(m_dtype); }
+
+    /**
+     * @brief Verifica se um valor é nulo
+     * @param index Índice do valor (0-based)
+     * @return true se o valor for nulo
+     */
+    bool isNull(size_t index) const;
+
+    /**
+     * @brief Conta os valores nulos da coluna
+     * @return Número de valores nulos (calculado uma única vez, na construção)
+     */
+    size_t nullCount() const { return m_nullCount; }
+
+    /**
+     * @brief Estima a memória ocupada pela coluna
+     *
+     * Inclui valores (ou códigos), mapa de validade, referências de texto e
+     * o texto referenciado, mesmo que compartilhado com outras colunas.
+     *
+     * @return Número aproximado de bytes
+     */
+    size_t memoryUsage() const;
+
+    /**
+     * @brief Obtém o mapa de validade da coluna (estilo Arrow)
+     *
+     * O bit i é 1 se o valor i não for nulo. O mapa é montado uma única vez
+     * na construção da coluna.
+     *
+     * @return Mapa de bits com size() bits
+     */
+    const Bitmap& validity() const { return *m_validity; }
+
+    /**
+     * @brief Acesso aos valores de uma coluna float64
+     * @return Buffer contíguo de valores
+     * @throws std::logic_error se a coluna não for float64
+     */
+    std::span<const double> float64() const;
+
+    /**
+     * @brief Acesso aos valores de uma coluna int64
+     * @return Buffer contíguo de valores
+     * @throws std::logic_error se a coluna não for int64
+     */
+    std::span<const int64_t> int64() const;
+
+    /**
+     * @brief Acesso aos valores de uma coluna booleana
+     * @return Buffer contíguo de valores (0 ou 1)
+     * @throws std::logic_error se a coluna não for bool
+     */
+    std::span<const uint8_t> boolean() const;
+
+    /**
+     * @brief Acesso aos valores de uma coluna datetime
+     * @return Nanossegundos desde 1970-01-01 (kNaT para nulos)
+     * @throws std::logic_error se a coluna não for datetime
+     */
+    std::span<const int64_t> datetime() const;
+
+    /**
+     * @brief Acesso aos valores de uma coluna de texto
+     * @return Valores, válidos enquanto a coluna existir
+     * @throws std::logic_error se a coluna não for string
+     */
+    std::span<const std::string_view> strings() const;
+
+    /**
+     * @brief Obtém o dicionário de uma coluna categórica
+     * @return Categorias, na ordem dos códigos
+     * @throws std::logic_error se a coluna não for categórica
+     */
+    std::span<const std::string_view> categories() const;
+
+    /**
+     * @brief Obtém o código de um valor de uma coluna categórica
+     * @param index Índice do valor (0-based)
+     * @return Posição no dicionário, ou kNullCode se o valor for nulo
+     */
+    uint32_t code(size_t index) const;
+
+    /**
+     * @brief Procura um valor no dicionário de uma coluna categórica
+     * @param value Valor
+     * @return Código do valor, ou kNullCode se ele não for uma categoria
+     */
+    uint32_t findCategory(std::string_view value) const;
+
+    /**
+     * @brief Marca os valores iguais a um texto
+     *
+     * Em colunas categóricas, o texto é procurado uma única vez no
+     * dicionário e a comparação é feita entre códigos inteiros.
+     *
+     * @param value Texto comparado com a representação de cada valor
+     * @return Mapa de bits com 1 nas linhas iguais a @p value (nulos nunca são iguais)
+     */
+    Bitmap equalTo(std::string_view value) const;
+
+    /**
+     * @brief Compara os valores de uma coluna numérica com um número
+     *
+     * Usa os kernels vetorizados de compare.hpp sobre o buffer da coluna;
+     * inteiros são comparados sem conversão para double. Nulos só
+     * satisfazem CompareOp::NotEqual, como no pandas.
+     *
+     * @param op Operador
+     * @param value Valor comparado
+     * @return Mapa de bits com 1 nas linhas em que a comparação é verdadeira
+     * @throws std::invalid_argument se a coluna não for numérica
+     */
+    Bitmap compare(CompareOp op, double value) const;
+
+    /**
+     * @brief Marca os valores entre dois números, inclusive (como Series.between() do pandas)
+     * @param low Limite inferior
+     * @param high Limite superior
+     * @return Mapa de bits com 1 nas linhas com valores em [low, high]
+     * @throws std::invalid_argument se a coluna não for numérica
+     */
+    Bitmap between(double low, double high) const;
+
+    /**
+     * @brief Marca os valores que pertencem a um conjunto de números (como Series.isin() do pandas)
+     *
+     * Em colunas int64 e bool, a comparação é exata, como em compare():
+     * apenas os números inteiros de @p values são procurados, como int64.
+     *
+     * @param values Números procurados
+     * @return Mapa de bits com 1 nas linhas cujo valor está em @p values (nulos nunca estão)
+     * @throws std::invalid_argument se a coluna não for numérica
+     */
+    Bitmap isin(std::span<const double> values) const;
+
+    /**
+     * @brief Marca os valores que pertencem a um conjunto de textos
+     *
+     * Em colunas categóricas, cada texto é procurado uma única vez no
+     * dicionário e as linhas são marcadas pelos códigos.
+     *
+     * @param values Textos comparados com a representação de cada valor
+     * @return Mapa de bits com 1 nas linhas cujo valor está em @p values (nulos nunca estão)
+     */
+    Bitmap isin(std::span<const std::string_view> values) const;
+
+    /**
+     * @brief Obtém um valor como double
+     * @param index Índice do valor (0-based)
+     * @return Valor numérico ou NaN se nulo ou não numérico (incluindo datetime)
+     */
+    double getDouble(size_t index) const;
+
+    /**
+     * @brief Converte a coluna para double com máscara de validade
+     *
+     * Colunas numéricas são copiadas (NaN é inválido); colunas de texto
+     * são convertidas com parseDouble(), sem exceções.
+     *
+     * @return Valores, máscara de validade e contagens
+     */
+    NumericBuffer toNumeric() const;
+
+    /**
+     * @brief Obtém a representação textual de um valor
+     * @param index Índice do valor (0-based)
+     * @return Valor formatado (string vazia para nulos)
+     */
+    std::string getString(size_t index) const;
+
+    /**
+     * @brief Calcula quantis dos valores válidos (interpolação linear, como no pandas)
+     *
+     * A primeira consulta usa seleção (selectQuantiles) sobre uma cópia dos
+     * valores válidos, em O(n). A partir da segunda, os valores válidos são
+     * ordenados uma única vez e mantidos em cache na coluna, de modo que
+     * consultas repetidas (mediana, describe(), quantile()) custam O(1) por
+     * quantil. O cache é compartilhado pelas cópias da coluna e pode ser
+     * consultado por várias threads.
+     *
+     * @param qs Quantis desejados (entre 0 e 1)
+     * @return Quantis na ordem pedida (NaN se a coluna não for numérica ou não tiver valores)
+     * @throws std::invalid_argument se algum quantil estiver fora de [0, 1]
+     */
+    std::vector<double> quantiles(std::span<const double> qs) const;
+
+    /**
+     * @brief Aplica uma função ao buffer numérico da coluna
+     *
+     * A função recebe um std::span<const double>, std::span<const int64_t>
+     * ou std::span<const uint8_t> conforme o tipo da coluna, sem cópias.
+     *
+     * @param func Função genérica a ser aplicada
+     * @param fallback Valor retornado para colunas de texto
+     * @return Resultado de func ou fallback
+     */
+    template <typename Func, typename Result>
+    Result visitNumeric(Func&& func, Result fallback) const {
+        switch (m_dtype) {
+            case DType::Float64: return func(std::span<const double>(m_float64));
+            case DType::Int64:   return func(std::span<const int64_t>(m_int64));
+            case DType::Bool:    return func(std::span<const uint8_t>(m_bool));
+            default:             return fallback;
+        }
+    }
+
+    /**
+     * @brief Aplica uma função aos códigos de uma coluna categórica
+     *
+     * A função recebe um std::span<const uint8_t>, std::span<const uint16_t>
+     * ou std::span<const uint32_t> conforme a largura dos códigos; o maior
+     * valor do tipo indica nulo.
+     *
+     * @param func Função genérica a ser aplicada
+     * @param fallback Valor retornado para colunas não categóricas
+     * @return Resultado de func ou fallback
+     */
+    template <typename Func, typename Result>
+    Result visitCodes(Func&& func, Result fallback) const {
+        if (m_dtype != DType::Category) {
+            return fallback;
+        }
+        switch (categoryCodeWidth(m_strings.size())) {
+            case 1:  return func(std::span<const uint8_t>(m_codes8));
+            case 2:  return func(std::span<const uint16_t>(m_codes16));
+            default: return func(std::span<const uint32_t>(m_codes32));
+        }
+    }
+
+    /**
+     * @brief Modifica em lugar os valores de uma coluna float64
+     *
+     * A função recebe um std::span<double> com os valores. Se eles forem
+     * compartilhados com outra coluna (ValueBuffer::shared()), são copiados
+     * antes; as demais cópias não veem a alteração. A validade e o cache de
+     * ordenação são refeitos ao final.
+     *
+     * @param func Função que escreve os novos valores
+     * @throws std::logic_error se a coluna não for float64
+     */
+    template <typename Func>
+    void updateFloat64(Func&& func) {
+        if (m_dtype != DType::Float64) {
+            throw std::logic_error("Column is not float64");
+        }
+        func(m_float64.mutableValues());
+        buildValidity();
+    }
+
+private:
+    /**
+     * @brief Converte os campos para um tipo
+     * @param cells Campos textuais (movidos se o tipo for string)
+     * @param dtype Tipo de dados desejado
+     * @param owner Dono da memória referenciada pelos campos
+     * @param strict Se true, falha com valores inválidos; senão, eles se tornam nulos
+     * @return false se strict e algum valor não couber no tipo
+     */
+    bool convertFrom(std::vector<std::string_view>& cells, DType dtype,
+                     const std::shared_ptr<const void>& owner, bool strict);
+
+    /**
+     * @brief Monta o mapa de validade e a contagem de nulos a partir dos valores
+     *
+     * Também cria o cache de ordenação da coluna, vazio.
+     */
+    void buildValidity();
+
+    /**
+     * @brief Codifica valores de texto como categorias
+     *
+     * O dicionário é copiado para um armazenamento próprio, de modo que a
+     * coluna não mantém vivo o texto de origem. Valores vazios são nulos.
+     *
+     * @param values Valores de texto
+     */
+    void encodeCategories(std::span<const std::string_view> values);
+
+    /**
+     * @brief Armazena os códigos na largura adequada ao dicionário atual
+     * @param codes Códigos (kNullCode para nulos)
+     */
+    void assignCodes(std::span<const uint32_t> codes);
+
+    /**
+     * @brief Obtém o texto de cada valor de uma coluna categórica
+     * @return Uma referência ao dicionário por valor (vazia para nulos)
+     */
+    std::vector<std::string_view> decodeCategories() const;
+
+    /**
+     * @brief Copia os valores numéricos válidos como double
+     * @return Valores não nulos, na ordem da coluna
+     */
+    std::vector<double> validValues() const;
+
+    struct SortCache;
+
+    DType m_dtype = DType::String;
+    ValueBuffer<double> m_float64;        ///< Valores float64
+    ValueBuffer<int64_t> m_int64;         ///< Valores int64 ou datetime
+    ValueBuffer<uint8_t> m_bool;          ///< Valores booleanos
+    ValueBuffer<uint8_t> m_codes8;        ///< Códigos de categorias (até 254 categorias)
+    ValueBuffer<uint16_t> m_codes16;      ///< Códigos de categorias (até 65534 categorias)
+    ValueBuffer<uint32_t> m_codes32;      ///< Códigos de categorias (demais casos)
+    ValueBuffer<std::string_view> m_strings; ///< Valores de texto, ou o dicionário de categorias
+    std::shared_ptr<const void> m_storage;   ///< Dono da memória dos valores de texto e das categorias
+    std::shared_ptr<const Bitmap> m_validity = std::make_shared<const Bitmap>(); ///< Bit i = 1 se o valor i não for nulo
+    size_t m_nullCount = 0;               ///< Número de valores nulos
+    std::shared_ptr<SortCache> m_sortCache; ///< Valores válidos ordenados, sob demanda
+};
+
+/**
+ * @brief Iterador de visões de colunas e linhas
+ *
+ * Percorre as posições da visão e produz o texto de cada valor sob
+ * demanda, sem materializar a coluna ou a linha inteira.
+ */
+template <typename View>
+class ViewIterator {
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = std::string;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = std::string;
+
+    ViewIterator() = default;
+    ViewIterator(const View* view, size_t index) : m_view(view), m_index(index) {}
+
+    std::string operator*() const { return (*m_view)[m_index]; }
+
+    ViewIterator& operator++() {
+        ++m_index;
+        return *this;
+    }
+
+    ViewIterator operator++(int) {
+        ViewIterator previous = *this;
+        ++m_index;
+        return previous;
+    }
+
+    bool operator==(const ViewIterator& other) const = default;
+
+private:
+    const View* m_view = nullptr;
+    size_t m_index = 0;
+};
+
+/**
+ * @class ColumnView
+ * @brief Visão não proprietária de uma coluna tipada
+ *
+ * Não copia valores: o acesso tipado (float64(), strings(), ...) devolve
+ * o buffer da própria coluna e o acesso textual formata um valor por vez.
+ * A visão é válida enquanto a coluna de origem existir.
+ */
+class ColumnView {
+public:
+    using iterator = ViewIterator<ColumnView>;
+
+    /**
+     * @brief Construtor padrão (visão vazia)
+     */
+    ColumnView() = default;
+
+    /**
+     * @brief Cria uma visão de uma coluna
+     * @param buffer Coluna referenciada
+     */
+    explicit ColumnView(const ColumnBuffer& buffer) : m_buffer(&buffer) {}
+
+    /**
+     * @brief Obtém o número de valores
+     * @return Número de valores
+     */
+    size_t size() const { return m_buffer ? m_buffer->size() : 0; }
+
+    /**
+     * @brief Verifica se a visão está vazia
+     * @return true se não houver valores
+     */
+    bool empty() const { return size() == 0; }
+
+    /**
+     * @brief Obtém o tipo de dados da coluna
+     * @return Tipo de dados
+     */
+    DType dtype() const { return buffer().dtype(); }
+
+    /**
+     * @brief Obtém a representação textual de um valor, sem verificar o índice
+     * @param index Índice do valor (0-based)
+     * @return Valor formatado (string vazia para nulos)
+     */
+    std::string operator[](size_t index) const { return m_buffer->getString(index); }
+
+    /**
+     * @brief Obtém a representação textual de um valor
+     * @param index Índice do valor (0-based)
+     * @return Valor formatado (string vazia para nulos)
+     * @throws std::out_of_range se o índice for inválido
+     */
+    std::string at(size_t index) const {
+        if (index >= size()) {
+            throw std::out_of_range("Row index out of range");
+        }
+        return m_buffer->getString(index);
+    }
+
+    /**
+     * @brief Verifica se um valor é nulo
+     * @param index Índice do valor (0-based)
+     * @return true se o valor for nulo
+     */
+    bool isNull(size_t index) const { return m_buffer->isNull(index); }
+
+    /**
+     * @brief Obtém um valor como double
+     * @param index Índice do valor (0-based)
+     * @return Valor numérico ou NaN se nulo ou não numérico
+     */
+    double getDouble(size_t index) const { return m_buffer->getDouble(index); }
+
+    std::span<const double> float64() const { return buffer().float64(); }
+    std::span<const int64_t> int64() const { return buffer().int64(); }
+    std::span<const uint8_t> boolean() const { return buffer().boolean(); }
+    std::span<const int64_t> datetime() const { return buffer().datetime(); }
+    std::span<const std::string_view> strings() const { return buffer().strings(); }
+
+    /**
+     * @brief Converte a coluna para double com máscara de validade
+     * @return Valores, máscara de validade e contagens
+     */
+    NumericBuffer toNumeric() const { return buffer().toNumeric(); }
+
+    /**
+     * @brief Marca os valores entre dois números, inclusive (ver ColumnBuffer::between())
+     * @param low Limite inferior
+     * @param high Limite superior
+     * @return Máscara de linhas
+     */
+    Bitmap between(double low, double high) const { return buffer().between(low, high); }
+
+    /**
+     * @brief Marca os valores que pertencem a uma lista de números
+     *
+     * Exemplo: @code Bitmap mask = df["Year"].isin({2019, 2020}); @endcode
+     *
+     * @param values Números procurados
+     * @return Máscara de linhas
+     */
+    Bitmap isin(std::initializer_list<double> values) const {
+        return buffer().isin(std::span<const double>(values.begin(), values.size()));
+    }
+
+    /**
+     * @brief Marca os valores que pertencem a uma lista de textos
+     *
+     * Exemplo: @code Bitmap mask = df["Site_Id"].isin({"Bay", "Lake"}); @endcode
+     *
+     * @param values Textos procurados
+     * @return Máscara de linhas
+     */
+    Bitmap isin(std::initializer_list<std::string_view> values) const {
+        return buffer().isin(std::span<const std::string_view>(values.begin(), values.size()));
+    }
+
+    /**
+     * @brief Marca os valores que pertencem a um vetor de números
+     * @param values Números procurados
+     * @return Máscara de linhas
+     */
+    Bitmap isin(const std::vector<double>& values) const { return buffer().isin(std::span<const double>(values)); }
+
+    /**
+     * @brief Marca os valores que pertencem a um vetor de textos
+     * @param values Textos procurados
+     * @return Máscara de linhas
+     */
+    Bitmap isin(const std::vector<std::string>& values) const {
+        std::vector<std::string_view> views(values.begin(), values.end());
+        return buffer().isin(std::span<const std::string_view>(views));
+    }
+
+    /**
+     * @brief Obtém a coluna referenciada
+     * @return Referência para a coluna tipada
+     * @throws std::logic_error se a visão estiver vazia
+     */
+    const ColumnBuffer& buffer() const {
+        if (!m_buffer) {
+            throw std::logic_error("Empty column view");
+        }
+        return *m_buffer;
+    }
+
+    /**
+     * @brief Copia os valores como texto
+     * @return Um valor formatado por linha
+     */
+    std::vector<std::string> toVector() const {
+        std::vector<std::string> values;
+        values.reserve(size());
+        for (size_t i = 0; i < size(); ++i) {
+            values.push_back(m_buffer->getString(i));
+        }
+        return values;
+    }
+
+    iterator begin() const { return iterator(this, 0); }
+    iterator end() const { return iterator(this, size()); }
+
+private:
+    const ColumnBuffer* m_buffer = nullptr;  ///< Coluna referenciada
+};
+
+/**
+ * @name Comparações de colunas
+ * @brief Produzem máscaras de linhas (Bitmap), combináveis com &, | e ~
+ *
+ * Exemplo:
+ * @code
+ * Bitmap mask = (df["pH"] > 7.5) & ~(df["Site_Id"] == "Bay");
+ * DataFrame selected = df[mask];
+ * @endcode
+ * @{
+ */
+inline Bitmap operator==(const ColumnView& column, double value) { return column.buffer().compare(CompareOp::Equal, value); }
+inline Bitmap operator!=(const ColumnView& column, double value) { return column.buffer().compare(CompareOp::NotEqual, value); }
+inline Bitmap operator<(const ColumnView& column, double value) { return column.buffer().compare(CompareOp::Less, value); }
+inline Bitmap operator<=(const ColumnView& column, double value) { return column.buffer().compare(CompareOp::LessEqual, value); }
+inline Bitmap operator>(const ColumnView& column, double value) { return column.buffer().compare(CompareOp::Greater, value); }
+inline Bitmap operator>=(const ColumnView& column, double value) { return column.buffer().compare(CompareOp::GreaterEqual, value); }
+inline Bitmap operator==(const ColumnView& column, std::string_view value) { return column.buffer().equalTo(value); }
+inline Bitmap operator!=(const ColumnView& column, std::string_view value) { return ~column.buffer().equalTo(value); }
+/** @} */
+
+} // namespace CPPandas
+
+#endif // CPPANDAS_COLUMN_HPP
@@ -0,0 +1,112 @@
+/**
+ * @file compare.hpp
+ * @brief Comparações vetorizadas de valores numéricos, produzindo máscaras de linhas (Bitmap)
+ * @author CPPandas Team
+ */
+
+#ifndef CPPANDAS_COMPARE_HPP
+#define CPPANDAS_COMPARE_HPP
+
+#include "cppandas/bitmap.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace CPPandas {
+
+/**
+ * @brief Operadores de comparação com um valor
+ */
+enum class CompareOp {
+    Equal,        ///< ==
+    NotEqual,     ///< !=
+    Less,         ///< <
+    LessEqual,    ///< <=
+    Greater,      ///< >
+    GreaterEqual  ///< >=
+};
+
+/**
+ * @brief Marca os valores dentro de um intervalo fechado [low, high]
+ *
+ * Escreve 64 linhas por palavra do mapa com AVX-512 ou AVX2 quando
+ * disponíveis. NaN nunca pertence ao intervalo.
+ *
+ * @param values Valores
+ * @param low Limite inferior (inclusivo)
+ * @param high Limite superior (inclusivo)
+ * @return Mapa de bits com 1 nas posições dos valores no intervalo
+ */
+Bitmap inRange(std::span<const double> values, double low, double high);
+
+/**
+ * @brief Marca os valores int64 dentro de um intervalo fechado [low, high]
+ * @param values Valores
+ * @param low Limite inferior (inclusivo)
+ * @param high Limite superior (inclusivo)
+ * @return Mapa de bits com 1 nas posições dos valores no intervalo
+ */
+Bitmap inRange(std::span<const int64_t> values, int64_t low, int64_t high);
+
+/**
+ * @brief Compara cada valor com @p value
+ *
+ * Toda comparação é reduzida a um intervalo fechado (por exemplo, x > 7
+ * vira x >= o próximo double depois de 7) e resolvida por inRange(). Como
+ * no pandas, NaN só satisfaz NotEqual.
+ *
+ * @param values Valores
+ * @param op Operador
+ * @param value Valor comparado
+ * @return Mapa de bits com 1 nas posições em que "values[i] op value" é verdadeiro
+ */
+Bitmap compare(std::span<const double> values, CompareOp op, double value);
+
+/**
+ * @brief Compara cada valor int64 com @p value, sem perda de precisão nos valores
+ * @param values Valores
+ * @param op Operador
+ * @param value Valor comparado
+ * @return Mapa de bits com 1 nas posições em que "values[i] op value" é verdadeiro
+ */
+Bitmap compare(std::span<const int64_t> values, CompareOp op, double value);
+
+/**
+ * @brief Compara cada valor booleano (0 ou 1) com @p value
+ * @param values Valores
+ * @param op Operador
+ * @param value Valor comparado
+ * @return Mapa de bits com 1 nas posições em que "values[i] op value" é verdadeiro
+ */
+Bitmap compare(std::span<const uint8_t> values, CompareOp op, double value);
+
+/**
+ * @brief Marca os valores entre @p low e @p high, inclusive (como Series.between() do pandas)
+ * @param values Valores
+ * @param low Limite inferior
+ * @param high Limite superior
+ * @return Mapa de bits com 1 nas posições dos valores no intervalo
+ */
+Bitmap between(std::span<const double> values, double low, double high);
+
+/**
+ * @brief Marca os valores int64 entre @p low e @p high, inclusive
+ * @param values Valores
+ * @param low Limite inferior
+ * @param high Limite superior
+ * @return Mapa de bits com 1 nas posições dos valores no intervalo
+ */
+Bitmap between(std::span<const int64_t> values, double low, double high);
+
+/**
+ * @brief Marca os valores booleanos (0 ou 1) entre @p low e @p high, inclusive
+ * @param values Valores
+ * @param low Limite inferior
+ * @param high Limite superior
+ * @return Mapa de bits com 1 nas posições dos valores no intervalo
+ */
+Bitmap between(std::span<const uint8_t> values, double low, double high);
+
+} // namespace CPPandas
+
+#endif // CPPANDAS_COMPARE_HPP
@@ -8,6 +8,13 @@
 #define CPPANDAS_HPP
 
 #include "cppandas/csv.hpp"
+#include "cppandas/numeric.hpp"
+#include "cppandas/schema.hpp"
+#include "cppandas/execution.hpp"
+#include "cppandas/reduce.hpp"
+#include "cppandas/quantile.hpp"
+#include "cppandas/frequency.hpp"
+#include <concepts>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -22,6 +29,7 @@
 #include <map>
 #include <set>
 #include <functional>
+#include <mutex>
 #include <sstream>
 
 namespace CPPandas {
@@ -199,20 +207,218 @@ public:
     }
 };
 
+/**
+ * @brief Resultado de value_counts(): valores distintos de uma coluna e suas frequências
+ */
+struct ValueCounts {
+    std::vector<std::string> values;  ///< Valores, do mais frequente para o menos frequente
+    std::vector<double> counts;       ///< Contagens, ou proporções se normalize = true
+
+    /**
+     * @brief Obtém o número de valores distintos listados
+     * @return Número de valores
+     */
+    size_t size() const { return values.size(); }
+
+    /**
+     * @brief Exibe os valores e as contagens, um por linha
+     */
+    void print() const {
+        size_t width = 10;
+        for (const auto& value : values) {
+            width = std::max(width, value.size() + 2);
+        }
+        for (size_t i = 0; i < values.size(); ++i) {
+            std::cout << std::left << std::setw(width) << values[i] << std::right << counts[i] << std::endl;
+        }
+    }
+};
+
+/**
+ * @brief Estatísticas descritivas de uma coluna numérica, calculadas em uma única passada
+ */
+struct ColumnSummary {
+    size_t count = 0;                                        ///< Valores não nulos
+    double mean = std::numeric_limits<double>::quiet_NaN();  ///< Média
+    double std = std::numeric_limits<double>::quiet_NaN();   ///< Desvio padrão amostral (n - 1)
+    double min = std::numeric_limits<double>::quiet_NaN();   ///< Valor mínimo
+    double max = std::numeric_limits<double>::quiet_NaN();   ///< Valor máximo
+    std::vector<double> percentiles;                         ///< Quantis na ordem pedida
+};
+
 class DataFrame {
 private:
-    CSV m_csv;
+    std::shared_ptr<CSV> m_csv = std::make_shared<CSV>(); // Colunas, compartilhadas entre cópias e projeções (cópia na escrita)
     std::vector<std::string> m_activeColumns; // Para rastrear quais colunas estão ativas
+    std::vector<size_t> m_columnIndices;      // Posição no CSV de cada coluna ativa
+    std::unordered_map<std::string, size_t> m_activePositions; // Nome -> posição entre as colunas ativas
+    bool m_allColumns = true;                 // Se as colunas ativas são todas as do CSV, na ordem original
+    // Matriz de data() das colunas ativas, montada uma única vez mesmo com
+    // chamadas concorrentes; alterações trocam o cache por um novo
+    struct RowCache {
+        std::once_flag buildOnce;
+        CSV::DataFrame rows;
+    };
+    std::shared_ptr<RowCache> m_rowCache = std::make_shared<RowCache>();
+
+    /**
+     * @brief Define as colunas ativas e resolve seus nomes uma única vez
+     *
+     * As posições no CSV ficam em m_columnIndices, de modo que o acesso a
+     * linhas e colunas não volta a comparar nomes.
+     *
+     * @param columns Nomes das colunas, todos existentes no CSV
+     */
+    void setActiveColumns(std::vector<std::string> columns) {
+        m_activeColumns = std::move(columns);
+        m_columnIndices.clear();
+        m_columnIndices.reserve(m_activeColumns.size());
+        m_activePositions.clear();
+        m_allColumns = m_activeColumns.size() == m_csv->columnCount();
+
+        for (size_t i = 0; i < m_activeColumns.size(); ++i) {
+            size_t index = m_csv->columnIndex(m_activeColumns[i]);
+            m_columnIndices.push_back(index);
+            m_activePositions.emplace(m_activeColumns[i], i);
+            m_allColumns = m_allColumns && index == i;
+        }
+        m_rowCache = std::make_shared<RowCache>();
+    }
+
+    // CSV para escrita: se outro DataFrame o compartilha, este passa a ter o seu
+    // (a cópia é O(colunas), pois as colunas também são compartilhadas)
+    CSV& mutableTable() {
+        if (m_csv.use_count() != 1) {
+            m_csv = std::make_shared<CSV>(*m_csv);
+        }
+        m_rowCache = std::make_shared<RowCache>();
+        return *m_csv;
+    }
+
+    // Tabela só com as colunas ativas; as colunas compartilham os valores com o CSV
+    CSV activeTable() const {
+        std::vector<ColumnBuffer> columns;
+        columns.reserve(m_columnIndices.size());
+        for (size_t index : m_columnIndices) {
+            columns.push_back(m_csv->column(index));
+        }
+        return CSV::fromColumns(m_activeColumns, std::move(columns));
+    }
+
+    // Expande os mapas de validade das colunas ativas em colunas bool
+    DataFrame nullMask(bool nulls) const {
+        std::vector<ColumnBuffer> columns;
+        columns.reserve(m_columnIndices.size());
+        for (size_t index : m_columnIndices) {
+            const Bitmap& validity = m_csv->column(index).validity();
+            std::vector<uint8_t> values(validity.size());
+            for (size_t row = 0; row < values.size(); ++row) {
+                values[row] = validity.test(row) != nulls;
+            }
+            columns.push_back(ColumnBuffer::fromBool(std::move(values)));
+        }
+        return fromColumns(m_activeColumns, std::move(columns));
+    }
 
 public:
     DataFrame() = default;
-    explicit DataFrame(const CSV& csv) : m_csv(csv) {
+    explicit DataFrame(const CSV& csv) : m_csv(std::make_shared<CSV>(csv)) {
         // Inicialmente, todas as colunas estão ativas
-        m_activeColumns = m_csv.headers();
+        setActiveColumns(m_csv->headers());
+    }
+    explicit DataFrame(CSV&& csv) : m_csv(std::make_shared<CSV>(std::move(csv))) {
+        setActiveColumns(m_csv->headers());
+    }
+
+    /**
+     * @brief Cria um DataFrame em memória a partir de colunas já tipadas
+     * @param names Nomes das colunas
+     * @param columns Colunas, uma por nome e todas com o mesmo tamanho
+     * @return DataFrame com as colunas fornecidas
+     * @throws std::invalid_argument se os tamanhos forem inconsistentes
+     */
+    static DataFrame fromColumns(std::vector<std::string> names, std::vector<ColumnBuffer> columns) {
+        return DataFrame(CSV::fromColumns(std::move(names), std::move(columns)));
+    }
+
+    /**
+     * @brief Cria um DataFrame em memória a partir de linhas de texto, inferindo os tipos
+     * @param headers Nomes das colunas
+     * @param rows Linhas de dados
+     * @return DataFrame com colunas tipadas
+     */
+    static DataFrame fromRows(std::vector<std::string> headers, const CSV::DataFrame& rows) {
+        return DataFrame(CSV::fromRows(std::move(headers), rows));
+    }
+
+    /**
+     * @brief Seleciona linhas pelo índice, mantendo os tipos das colunas ativas
+     * @param rowIndices Índices das linhas, na ordem desejada
+     * @param policy Execução sequencial ou paralela (uma tarefa por coluna)
+     * @return Novo DataFrame com as linhas selecionadas
+     * @throws std::out_of_range se algum índice for inválido
+     */
+    DataFrame take(const std::vector<size_t>& rowIndices,
+                   const ExecutionPolicy& policy = ExecutionPolicy()) const {
+        std::vector<ColumnBuffer> columns(m_columnIndices.size());
+        policy.forEach(columns.size(), rowIndices.size() * columns.size(), [&](size_t i) {
+            columns[i] = m_csv->column(m_columnIndices[i]).take(rowIndices);
+        });
+
+        return fromColumns(m_activeColumns, std::move(columns));
     }
     
+    /**
+     * @brief Converte todas as colunas ativas para um tipo (como df.astype() do pandas)
+     *
+     * Com "category", cada coluna passa a guardar um dicionário de valores
+     * distintos e um código inteiro por linha (1, 2 ou 4 bytes, conforme o
+     * número de categorias); comparações de igualdade e contagens de valores
+     * trabalham sobre os códigos.
+     *
+     * @param dtype Nome do tipo ("float64", "int64", "bool", "datetime64[ns]", "string" ou "category")
+     * @return Novo DataFrame com as colunas convertidas
+     * @throws std::invalid_argument se o nome do tipo não for reconhecido
+     */
+    DataFrame astype(const std::string& dtype) const {
+        DType target = dtypeFromName(dtype);
+        std::vector<ColumnBuffer> columns;
+        columns.reserve(m_columnIndices.size());
+        for (size_t index : m_columnIndices) {
+            columns.push_back(m_csv->column(index).astype(target));
+        }
+        return fromColumns(m_activeColumns, std::move(columns));
+    }
+
+    /**
+     * @brief Converte uma coluna ativa para um tipo, mantendo as demais
+     *
+     * Exemplo:
+     * @code
+     * DataFrame compact = df.astype("Site_Id", "category");
+     * Bitmap rows = compact.column("Site_Id").equalTo("Bay");
+     * @endcode
+     *
+     * @param columnName Nome da coluna
+     * @param dtype Nome do tipo (veja astype(const std::string&))
+     * @return Novo DataFrame com a coluna convertida
+     * @throws std::out_of_range se a coluna não estiver entre as ativas
+     * @throws std::invalid_argument se o nome do tipo não for reconhecido
+     */
+    DataFrame astype(const std::string& columnName, const std::string& dtype) const {
+        DType target = dtypeFromName(dtype);
+        const ColumnBuffer& converted = column(columnName);
+        std::vector<ColumnBuffer> columns;
+        columns.reserve(m_columnIndices.size());
+        for (size_t i = 0; i < m_columnIndices.size(); ++i) {
+            const ColumnBuffer& current = m_csv->column(m_columnIndices[i]);
+            columns.push_back(&current == &converted ? current.astype(target) : current);
+        }
+        return fromColumns(m_activeColumns, std::move(columns));
+    }
+
     // Acesso aos dados do CSV
-    size_t rowCount() const { return m_csv.rowCount(); }
+    size_t rowCount() const { return m_csv->rowCount(); }
     
     size_t columnCount() const { 
         return m_activeColumns.size(); 
@@ -222,56 +428,162 @@ public:
         return m_activeColumns;
     }
     
-    ModeResult mode() const {
-        std::vector<double> result;
-        result.reserve(m_activeColumns.size());
-
-        for (const auto& colName : m_activeColumns) {
-            result.push_back(mode(colName));
-        }
+    ModeResult mode(const ExecutionPolicy& policy = ExecutionPolicy()) const {
+        std::vector<double> result(m_activeColumns.size());
+        policy.forEach(result.size(), rowCount() * result.size(), [&](size_t i) {
+            result[i] = mode(m_activeColumns[i], ExecutionPolicy::sequential());
+        });
 
         return ModeResult(result);
     }
 
     // Acesso às linhas
     CSV::Row getRow(size_t rowIndex) const { 
-        if (m_activeColumns.size() == m_csv.headers().size()) {
-            // Se todas as colunas estão ativas, retorna a linha completa
-            return m_csv.getRow(rowIndex);
-        } else {
-            // Senão, filtra a linha para incluir apenas as colunas ativas
-            CSV::Row fullRow = m_csv.getRow(rowIndex);
-            CSV::Row filteredRow;
-            
-            for (const auto& colName : m_activeColumns) {
-                auto it = std::find(m_csv.headers().begin(), m_csv.headers().end(), colName);
-                if (it != m_csv.headers().end()) {
-                    size_t colIndex = std::distance(m_csv.headers().begin(), it);
-                    if (colIndex < fullRow.size()) {
-                        filteredRow.push_back(fullRow[colIndex]);
-                    }
-                }
-            }
-            
-            return filteredRow;
+        return rowView(rowIndex).toVector();
+    }
+
+    /**
+     * @brief Obtém uma visão de uma linha restrita às colunas ativas, sem copiar valores
+     * @param rowIndex Índice da linha (0-based)
+     * @return Visão da linha, válida enquanto o DataFrame existir
+     * @throws std::out_of_range se o índice for inválido
+     */
+    RowView rowView(size_t rowIndex) const {
+        if (rowIndex >= rowCount()) {
+            throw std::out_of_range("Row index out of range");
         }
+        return RowView(*m_csv, rowIndex, m_allColumns ? nullptr : &m_columnIndices);
     }
     
     // Acesso às colunas
     CSV::Column getColumn(const std::string& columnName) const { 
-        // Verifica se a coluna está ativa
-        auto it = std::find(m_activeColumns.begin(), m_activeColumns.end(), columnName);
-        if (it == m_activeColumns.end()) {
-            throw std::out_of_range("Column not in active columns");
-        }
-        return m_csv.getColumn(columnName);
+        return columnView(columnName).toVector();
     }
     
     CSV::Column getColumn(size_t columnIndex) const {
-        if (columnIndex >= m_activeColumns.size()) {
+        return columnView(columnIndex).toVector();
+    }
+
+    /**
+     * @brief Obtém uma visão de uma coluna ativa, sem copiar valores
+     * @param columnName Nome da coluna
+     * @return Visão da coluna, válida enquanto o DataFrame existir
+     */
+    ColumnView columnView(const std::string& columnName) const {
+        return ColumnView(column(columnName));
+    }
+
+    /**
+     * @brief Obtém uma visão de uma coluna ativa pela posição, sem copiar valores
+     * @param columnIndex Posição entre as colunas ativas (0-based)
+     * @return Visão da coluna, válida enquanto o DataFrame existir
+     */
+    ColumnView columnView(size_t columnIndex) const {
+        return ColumnView(column(columnIndex));
+    }
+
+    /**
+     * @brief Obtém o armazenamento tipado de uma coluna ativa, sem cópias
+     * @param columnName Nome da coluna
+     * @return Referência para a coluna tipada
+     */
+    const ColumnBuffer& column(const std::string& columnName) const {
+        auto it = m_activePositions.find(columnName);
+        if (it == m_activePositions.end()) {
+            throw std::out_of_range("Column not in active columns");
+        }
+        return m_csv->column(m_columnIndices[it->second]);
+    }
+
+    /**
+     * @brief Obtém o armazenamento tipado de uma coluna ativa pela posição, sem cópias
+     * @param columnIndex Posição entre as colunas ativas (0-based)
+     * @return Referência para a coluna tipada
+     */
+    const ColumnBuffer& column(size_t columnIndex) const {
+        if (columnIndex >= m_columnIndices.size()) {
+            throw std::out_of_range("Column index out of range");
+        }
+        return m_csv->column(m_columnIndices[columnIndex]);
+    }
+
+    /**
+     * @brief Substitui uma coluna ativa, em lugar
+     *
+     * Outros DataFrames que compartilham as colunas (cópias, projeções) não
+     * são afetados.
+     *
+     * @param columnIndex Posição entre as colunas ativas (0-based)
+     * @param values Nova coluna, com o mesmo número de linhas
+     * @throws std::out_of_range se a posição for inválida
+     * @throws std::invalid_argument se o tamanho da coluna for diferente
+     */
+    void setColumn(size_t columnIndex, ColumnBuffer values) {
+        if (columnIndex >= m_columnIndices.size()) {
             throw std::out_of_range("Column index out of range");
         }
-        return m_csv.getColumn(m_activeColumns[columnIndex]);
+        mutableTable().setColumn(m_columnIndices[columnIndex], std::move(values));
+    }
+
+    /**
+     * @brief Substitui uma coluna ativa pelo nome, em lugar
+     * @param columnName Nome da coluna
+     * @param values Nova coluna, com o mesmo número de linhas
+     * @throws std::out_of_range se a coluna não estiver entre as ativas
+     * @throws std::invalid_argument se o tamanho da coluna for diferente
+     */
+    void setColumn(const std::string& columnName, ColumnBuffer values) {
+        auto it = m_activePositions.find(columnName);
+        if (it == m_activePositions.end()) {
+            throw std::out_of_range("Column not in active columns");
+        }
+        setColumn(it->second, std::move(values));
+    }
+
+    /**
+     * @brief Modifica em lugar os valores de uma coluna ativa float64
+     *
+     * A função recebe um std::span<double>. Os valores só são copiados se
+     * estiverem compartilhados com outro DataFrame, que continua vendo os
+     * valores originais.
+     *
+     * @param columnIndex Posição entre as colunas ativas (0-based)
+     * @param func Função que escreve os novos valores
+     * @throws std::out_of_range se a posição for inválida
+     * @throws std::logic_error se a coluna não for float64
+     */
+    template <typename Func>
+    void updateFloat64(size_t columnIndex, Func&& func) {
+        if (columnIndex >= m_columnIndices.size()) {
+            throw std::out_of_range("Column index out of range");
+        }
+        mutableTable().updateFloat64(m_columnIndices[columnIndex], std::forward<Func>(func));
+    }
+
+    /**
+     * @brief Obtém o tipo de dados de uma coluna ativa
+     * @param columnName Nome da coluna
+     * @return Tipo de dados da coluna
+     */
+    DType dtype(const std::string& columnName) const {
+        return column(columnName).dtype();
+    }
+
+    /**
+     * @brief Obtém o esquema das colunas ativas
+     *
+     * Os tipos são definidos uma única vez na leitura (inferidos ou a partir
+     * de ReadOptions::schema); esta chamada não reexamina os valores.
+     *
+     * @return Nome e tipo de cada coluna ativa, na ordem das colunas
+     */
+    Schema schema() const {
+        const Schema& full = m_csv->schema();
+        Schema result;
+        for (const auto& colName : m_activeColumns) {
+            result.set(colName, full.dtype(colName));
+        }
+        return result;
     }
     
     // Seleção de colunas múltiplas (estilo pandas)
@@ -281,7 +593,7 @@ public:
         // Verificar se todas as colunas solicitadas existem
         std::vector<std::string> missingColumns;
         for (const auto& col : columns) {
-            if (std::find(m_csv.headers().begin(), m_csv.headers().end(), col) == m_csv.headers().end()) {
+            if (!m_csv->hasColumn(col)) {
                 missingColumns.push_back(col);
             }
         }
@@ -292,12 +604,74 @@ public:
         }
         
         // Atualizar colunas ativas
-        result.m_activeColumns = columns;
+        result.setActiveColumns(columns);
         
         return result;
     }
 
-    StatisticalSummary describe(const std::vector<double>& percentiles = {0.25, 0.5, 0.75}) const {
+    /**
+     * @brief Obtém uma coluna ativa pelo nome (estilo pandas), para comparações
+     *
+     * Comparações com números ou textos produzem máscaras de linhas (Bitmap),
+     * que podem ser combinadas e usadas em operator[](const Bitmap&):
+     * @code
+     * DataFrame selected = df[(df["pH"] > 7.5) & df["Site_Id"].isin({"Bay", "Lake"})];
+     * @endcode
+     *
+     * Listas entre chaves (df[{"a", "b"}]) continuam selecionando colunas.
+     *
+     * @param columnName Nome da coluna
+     * @return Visão da coluna, válida enquanto o DataFrame existir
+     * @throws ColumnNotFoundException se a coluna não estiver entre as ativas
+     */
+    template <typename Name>
+        requires std::convertible_to<const Name&, std::string_view>
+    ColumnView operator[](const Name& columnName) const {
+        std::string name{std::string_view(columnName)};
+        if (m_activePositions.find(name) == m_activePositions.end()) {
+            throw ColumnNotFoundException({name});
+        }
+        return columnView(name);
+    }
+
+    /**
+     * @brief Seleciona as linhas marcadas em uma máscara (como df[mask] do pandas)
+     * @param mask Máscara com um bit por linha
+     * @return Novo DataFrame com as linhas selecionadas, na ordem original
+     * @throws std::invalid_argument se o tamanho da máscara for diferente do número de linhas
+     */
+    DataFrame operator[](const Bitmap& mask) const {
+        return filter(mask);
+    }
+
+    /**
+     * @brief Seleciona as linhas marcadas em uma máscara
+     *
+     * Apenas as linhas selecionadas são copiadas, coluna a coluna (ver take()).
+     *
+     * @param mask Máscara com um bit por linha
+     * @param policy Execução sequencial ou paralela (uma tarefa por coluna)
+     * @return Novo DataFrame com as linhas selecionadas, na ordem original
+     * @throws std::invalid_argument se o tamanho da máscara for diferente do número de linhas
+     */
+    DataFrame filter(const Bitmap& mask, const ExecutionPolicy& policy = ExecutionPolicy()) const {
+        if (mask.size() != rowCount()) {
+            throw std::invalid_argument("Mask size does not match row count");
+        }
+        return take(mask.setBits(), policy);
+    }
+
+    /**
+     * @brief Resume as colunas numéricas (como df.describe() do pandas)
+     * @param percentiles Quantis incluídos no resumo (entre 0 e 1)
+     * @param policy Execução sequencial ou paralela (uma tarefa por coluna)
+     * @param approximate Se true, os quantis vêm de um TDigest (erro de posição de 1%),
+     *                    sem copiar nem reordenar as colunas
+     * @return Contagem, média, desvio padrão, mínimo, máximo e quantis por coluna
+     */
+    StatisticalSummary describe(const std::vector<double>& percentiles = {0.25, 0.5, 0.75},
+                                const ExecutionPolicy& policy = ExecutionPolicy(),
+                                bool approximate = false) const {
         StatisticalSummary summary;
 
         // Adicionar linhas padrão
@@ -308,73 +682,89 @@ public:
         summary.addRow("max");
 
         // Adicionar linhas para percentis
+        std::vector<std::string> percentileRows;
         for (double p : percentiles) {
             std::stringstream ss;
             ss << std::fixed << std::setprecision(1) << (p * 100) << "%";
-            summary.addRow(ss.str());
+            percentileRows.push_back(ss.str());
+            summary.addRow(percentileRows.back());
         }
 
-        // Determinar colunas numéricas
+        // Colunas numéricas, segundo o esquema definido na leitura (bool fica de fora, como no pandas)
         std::vector<std::string> numericColumns;
-
-        for (const auto& colName : m_activeColumns) {
-            auto column = getColumn(colName);
-
-            // Verificar se a coluna é numérica (pelo menos 70% dos valores não vazios são numéricos)
-            size_t numericCount = 0;
-            size_t nonEmptyCount = 0;
-
-            for (const auto& value : column) {
-                if (!value.empty()) {
-                    nonEmptyCount++;
-                    try {
-                        std::stod(value);
-                        numericCount++;
-                    } catch (...) {
-                        // Não é numérico
-                    }
-                }
-            }
-
-            double numericRatio = nonEmptyCount > 0 ? static_cast<double>(numericCount) / nonEmptyCount : 0.0;
-
-            if (numericRatio >= 0.7) {
+        const Schema columnTypes = schema();
+        for (const auto& [colName, type] : columnTypes.fields()) {
+            if (type == DType::Float64 || type == DType::Int64) {
                 numericColumns.push_back(colName);
                 summary.addColumn(colName);
             }
         }
 
-        // Calcular estatísticas para cada coluna numérica
-        for (const auto& colName : numericColumns) {
-            auto column = getColumn(colName);
-            auto numericValues = columnToNumeric(column);
+        // Uma passada por coluna, com as colunas distribuídas pelo pool
+        std::vector<ColumnSummary> results(numericColumns.size());
+        policy.forEach(numericColumns.size(), rowCount() * numericColumns.size(), [&](size_t i) {
+            results[i] = summarize(numericColumns[i], percentiles, approximate);
+        });
 
-            // Contar valores não-NaN
-            size_t count = 0;
-            for (double value : numericValues) {
-                if (!std::isnan(value)) {
-                    count++;
-                }
-            }
+        for (size_t i = 0; i < numericColumns.size(); ++i) {
+            const std::string& colName = numericColumns[i];
+            const ColumnSummary& stats = results[i];
+
+            summary.setValue("count", colName, stats.count);
+            summary.setValue("mean", colName, stats.mean);
+            summary.setValue("std", colName, stats.std);
+            summary.setValue("min", colName, stats.min);
+            summary.setValue("max", colName, stats.max);
 
-            // Estatísticas básicas
-            summary.setValue("count", colName, count);
-            summary.setValue("mean", colName, mean(colName));
-            summary.setValue("std", colName, std(colName));
-            summary.setValue("min", colName, min(colName));
-            summary.setValue("max", colName, max(colName));
-
-            // Percentis
-            for (double p : percentiles) {
-                std::stringstream ss;
-                ss << std::fixed << std::setprecision(1) << (p * 100) << "%";
-                summary.setValue(ss.str(), colName, quantile(colName, p));
+            for (size_t k = 0; k < percentiles.size(); ++k) {
+                summary.setValue(percentileRows[k], colName, stats.percentiles[k]);
             }
         }
 
         return summary;
     }
 
+    /**
+     * @brief Calcula as estatísticas descritivas de uma coluna numérica
+     *
+     * Contagem, média, variância, mínimo e máximo são obtidos juntos em uma
+     * única leitura da coluna (reduction()); todos os quantis são extraídos
+     * de uma vez por ColumnBuffer::quantiles(), com a mesma interpolação
+     * linear de quantile(), ou de um TDigest se @p approximate for true.
+     *
+     * @param columnName Nome da coluna
+     * @param percentiles Quantis desejados (entre 0 e 1)
+     * @param approximate Se true, usa approx_quantile() com erro de posição de 1%
+     * @return Estatísticas da coluna; valores NaN se ela não for numérica ou não tiver valores
+     * @throws std::invalid_argument se algum quantil estiver fora de [0, 1]
+     */
+    ColumnSummary summarize(const std::string& columnName,
+                            const std::vector<double>& percentiles = {0.25, 0.5, 0.75},
+                            bool approximate = false) const {
+        for (double q : percentiles) {
+            if (q < 0.0 || q > 1.0) {
+                throw std::invalid_argument("Quantile value must be between 0 and 1");
+            }
+        }
+
+        ColumnSummary stats;
+        stats.percentiles.assign(percentiles.size(), std::numeric_limits<double>::quiet_NaN());
+
+        Reduction moments = reduction(columnName);
+        stats.count = moments.count;
+        if (moments.count == 0) {
+            return stats;
+        }
+        stats.mean = moments.mean();
+        stats.std = moments.stddev();
+        stats.min = moments.min;
+        stats.max = moments.max;
+        stats.percentiles = approximate
+            ? approx_quantile(columnName, percentiles, kDefaultSketchAccuracy, ExecutionPolicy::sequential())
+            : column(columnName).quantiles(percentiles);
+        return stats;
+    }
+
 
     // Método info() similar ao pandas
     void info() const {
@@ -390,82 +780,16 @@ public:
                     << std::setw(15) << "Non-Null Count" << std::setw(15) << "Dtype" << std::endl;
             std::cout << std::string(60, '-') << std::endl;
             
-            // Pré-computar e armazenar as colunas para evitar chamadas repetidas a getColumn()
-            std::vector<CSV::Column> cachedColumns;
-            cachedColumns.reserve(m_activeColumns.size());
-            
-            for (const auto& colName : m_activeColumns) {
-                try {
-                    cachedColumns.push_back(m_csv.getColumn(colName));
-                } catch (const std::exception& e) {
-                    std::cerr << "Erro ao acessar coluna '" << colName << "': " << e.what() << std::endl;
-                    // Adicionar uma coluna vazia como fallback
-                    cachedColumns.push_back(CSV::Column());
-                }
-            }
-            
-            // Dados das colunas
+            // Tipos definidos na leitura; nenhum valor é reexaminado
+            Schema columnTypes = schema();
+            std::map<std::string, size_t> dtypeCounts;
+
             for (size_t i = 0; i < m_activeColumns.size(); ++i) {
                 const std::string& colName = m_activeColumns[i];
-                const CSV::Column& column = cachedColumns[i];
-                
-                // Contar valores não nulos com limite de verificação
-                size_t nonNullCount = 0;
-                size_t checkLimit = std::min(column.size(), size_t(1000)); // Limitar verificação
-                
-                for (size_t j = 0; j < checkLimit; j++) {
-                    if (!column[j].empty()) {
-                        nonNullCount++;
-                    }
-                }
-                
-                if (checkLimit < column.size()) {
-                    // Estimar para o resto da coluna
-                    nonNullCount = (nonNullCount * column.size()) / checkLimit;
-                }
-                
-                // Determinar o tipo de dados (simplificado e protegido)
-                std::string dtype = "string";
-                
-                // Verificar apenas as primeiras 100 linhas não vazias para determinar o tipo
-                bool allNumeric = true;
-                size_t checkedRows = 0;
-                
-                for (const auto& val : column) {
-                    if (val.empty()) continue;
-                    
-                    if (checkedRows >= 100) break; // Limite para evitar loop infinito
-                    
-                    checkedRows++;
-                    
-                    if (!std::all_of(val.begin(), val.end(), [](char c) {
-                        return std::isdigit(c) || c == '.' || c == '-' || c == '+' || c == 'e' || c == 'E';
-                    })) {
-                        allNumeric = false;
-                        break;
-                    }
-                }
-                
-                if (allNumeric && checkedRows > 0) {
-                    // Verificar se tem ponto decimal (apenas nas primeiras linhas)
-                    bool hasDecimal = false;
-                    checkedRows = 0;
-                    
-                    for (const auto& val : column) {
-                        if (val.empty()) continue;
-                        
-                        if (checkedRows >= 50) break; // Limite menor aqui
-                        
-                        checkedRows++;
-                        
-                        if (val.find('.') != std::string::npos) {
-                            hasDecimal = true;
-                            break;
-                        }
-                    }
-                    
-                    dtype = hasDecimal ? "float64" : "int64";
-                }
+                const ColumnBuffer& values = column(colName);
+                size_t nonNullCount = values.size() - values.nullCount();
+                std::string dtype = dtypeName(columnTypes.dtype(colName));
+                dtypeCounts[dtype]++;
                 
                 // Impressão da linha
                 std::cout << std::setw(5) << i 
@@ -474,13 +798,19 @@ public:
                         << std::setw(15) << dtype << std::endl;
             }
             
-            // Resumo de memória (simplificado e com limite de segurança)
+            // Resumo de tipos, no formato do pandas: "dtypes: float64(9), int64(1)"
+            std::cout << std::endl;
+            std::cout << "dtypes: ";
+            for (auto it = dtypeCounts.begin(); it != dtypeCounts.end(); ++it) {
+                std::cout << (it == dtypeCounts.begin() ? "" : ", ") << it->first << "(" << it->second << ")";
+            }
             std::cout << std::endl;
-            std::cout << "dtypes: mixed" << std::endl;
             
-            // Estimativa simplificada baseada apenas no número de elementos
-            size_t memoryUsage = m_activeColumns.size() * rowCount() * sizeof(std::string);
-            memoryUsage += m_activeColumns.size() * sizeof(std::string); // cabeçalhos
+            // Memória dos valores tipados (categorias ocupam apenas códigos e dicionário)
+            size_t memoryUsage = 0;
+            for (size_t i = 0; i < m_activeColumns.size(); ++i) {
+                memoryUsage += column(i).memoryUsage();
+            }
             
             std::cout << "memory usage: ~" << (memoryUsage / 1024) << " KB" << std::endl;
         } catch (const std::exception& e) {
@@ -491,9 +821,10 @@ public:
     void head(size_t n = 5) const {
         n = std::min(n, rowCount());
         
-        // Imprimir o cabeçalho
+        // Imprimir o cabeçalho (cada coluna ocupa 20 caracteres, começando
+        // por um espaço para que valores longos não se juntem)
         for (size_t i = 0; i < m_activeColumns.size(); ++i) {
-            std::cout << std::setw(20) << m_activeColumns[i];
+            std::cout << ' ' << std::setw(19) << m_activeColumns[i];
         }
         std::cout << std::endl;
         
@@ -505,74 +836,79 @@ public:
         
         // Imprimir as primeiras n linhas
         for (size_t rowIdx = 0; rowIdx < n; ++rowIdx) {
-            auto row = getRow(rowIdx);
+            RowView row = rowView(rowIdx);
             for (size_t colIdx = 0; colIdx < row.size(); ++colIdx) {
-                std::cout << std::setw(20) << row[colIdx];
+                // float64 com 6 casas decimais; a forma mais curta exata pode ter 17 dígitos
+                const ColumnBuffer& values = row.column(colIdx);
+                std::cout << ' ' << std::setw(19);
+                if (values.dtype() == DType::Float64 && !values.isNull(rowIdx)) {
+                    std::cout << std::to_string(values.getDouble(rowIdx));
+                } else {
+                    std::cout << row[colIdx];
+                }
             }
             std::cout << std::endl;
         }
     }
     
     // Acesso aos dados brutos (considerando apenas colunas ativas)
-    CSV::DataFrame data() const { 
-        if (m_activeColumns.size() == m_csv.headers().size()) {
-            // Se todas as colunas estão ativas, retorna todos os dados
-            return m_csv.data();
-        } else {
-            // Senão, filtra os dados para incluir apenas as colunas ativas
-            CSV::DataFrame filteredData;
-            filteredData.reserve(m_csv.rowCount());
-            
-            for (size_t i = 0; i < m_csv.rowCount(); ++i) {
-                filteredData.push_back(getRow(i));
-            }
-            
-            return filteredData;
+    /**
+     * @brief Obtém os dados das colunas ativas como matriz de strings
+     *
+     * Caminho de compatibilidade: a matriz é materializada na primeira chamada
+     * e mantida em cache (a do próprio CSV, se todas as colunas estiverem
+     * ativas na ordem original). Chamadas concorrentes são seguras. Para
+     * apenas ler, prefira rowView() e columnView().
+     *
+     * @return Matriz com os dados
+     */
+    const CSV::DataFrame& data() const { 
+        if (m_allColumns) {
+            return m_csv->data();
         }
+        std::call_once(m_rowCache->buildOnce, [this]() {
+            CSV::DataFrame& rows = m_rowCache->rows;
+            rows.reserve(rowCount());
+            for (size_t i = 0; i < rowCount(); ++i) {
+                rows.push_back(rowView(i).toVector());
+            }
+        });
+        return m_rowCache->rows;
     }
     
     // Salvar dados
-    bool save(const std::string& filename, char delimiter = ',') const { 
-        if (m_activeColumns.size() == m_csv.headers().size()) {
-            // Se todas as colunas estão ativas, salva diretamente
-            return m_csv.save(filename, delimiter); 
-        } else {
-            // Senão, cria um CSV temporário com apenas as colunas ativas
-            CSV tempCsv;
-            
-            // Configurar cabeçalho
-            std::vector<std::string> headers = m_activeColumns;
-            
-            // Configurar dados
-            CSV::DataFrame data;
-            for (size_t i = 0; i < m_csv.rowCount(); ++i) {
-                data.push_back(getRow(i));
-            }
-            
-            // Criar CSV temporário manualmente e salvar
-            std::ofstream file(filename);
-            if (!file.is_open()) {
-                return false;
-            }
-            
-            // Escrever cabeçalho
-            for (size_t i = 0; i < headers.size(); ++i) {
-                if (i > 0) file << delimiter;
-                file << headers[i];
-            }
-            file << '\n';
-            
-            // Escrever dados
-            for (const auto& row : data) {
-                for (size_t i = 0; i < row.size(); ++i) {
-                    if (i > 0) file << delimiter;
-                    file << row[i];
-                }
-                file << '\n';
-            }
-            
-            return true;
-        }
+    bool save(const std::string& filename, char delimiter = ',') const {
+        WriteOptions options;
+        options.delimiter = delimiter;
+        return save(filename, options);
+    }
+
+    /**
+     * @brief Salva as colunas ativas em um arquivo CSV, em fluxo
+     *
+     * Veja CSV::save(const std::string&, const WriteOptions&): blocos de
+     * linhas de tamanho fixo, formatação com std::to_chars, aspas conforme
+     * a RFC 4180 e, opcionalmente, formatação em paralelo.
+     *
+     * @param filename Nome do arquivo
+     * @param options Delimitador, cabeçalho, threads e tamanho dos blocos
+     * @return true se o arquivo foi salvo com sucesso, false caso contrário
+     */
+    bool save(const std::string& filename, const WriteOptions& options) const {
+        return m_allColumns ? m_csv->save(filename, options) : activeTable().save(filename, options);
+    }
+
+    /**
+     * @brief Salva as colunas ativas no formato binário colunar (ver CSV::saveBinary())
+     *
+     * O arquivo guarda os valores já tipados, os mapas de validade e o
+     * esquema; CPPandas::read_binary() o reabre sem conversão de texto.
+     *
+     * @param filename Nome do arquivo
+     * @return true se o arquivo foi salvo com sucesso, false caso contrário
+     */
+    bool to_binary(const std::string& filename) const {
+        return m_allColumns ? m_csv->saveBinary(filename) : activeTable().saveBinary(filename);
     }
 
     // Add this method to your DataFrame class in cppandas.hpp
@@ -581,11 +917,11 @@ public:
  * @brief Remove rows with missing values (similar to pandas dropna())
  * @param subset Vector of column names to consider for NA values. If empty, all columns are used.
  * @param how String specifying how to drop rows. "any" drops rows with any NA value, "all" drops only if all values are NA.
+ * @param policy Sequential or parallel execution (row chunks for the mask, one task per column for the copy)
  * @return A new DataFrame with NA rows removed
  */
-    DataFrame dropna(const std::vector<std::string>& subset = {}, const std::string& how = "any") const {
-        DataFrame result(*this);
-
+    DataFrame dropna(const std::vector<std::string>& subset = {}, const std::string& how = "any",
+                     const ExecutionPolicy& policy = ExecutionPolicy()) const {
         // Determine which columns to check for NA values
         std::vector<std::string> columnsToCheck;
         if (subset.empty()) {
@@ -594,100 +930,95 @@ public:
         } else {
             // Verify all columns in subset exist
             for (const auto& col : subset) {
-                if (std::find(m_activeColumns.begin(), m_activeColumns.end(), col) == m_activeColumns.end()) {
+                if (m_activePositions.find(col) == m_activePositions.end()) {
                     throw ColumnNotFoundException({col});
                 }
             }
             columnsToCheck = subset;
         }
 
-        // Get indices of rows to keep
-        std::vector<size_t> rowsToKeep;
-
-        for (size_t rowIndex = 0; rowIndex < m_csv.rowCount(); ++rowIndex) {
-            bool keepRow = true;
-
-            if (how == "any") {
-                // Drop row if ANY specified column has NA/empty value
-                for (const auto& colName : columnsToCheck) {
-                    try {
-                        const std::string& cellValue = m_csv.getColumn(colName)[rowIndex];
-                        if (cellValue.empty()) {
-                            keepRow = false;
-                            break;
-                        }
-                    } catch (const std::exception& e) {
-                        keepRow = false;
-                        break;
-                    }
-                }
-            } else if (how == "all") {
-                // Drop row only if ALL specified columns have NA/empty values
-                keepRow = false;
-                for (const auto& colName : columnsToCheck) {
-                    try {
-                        const std::string& cellValue = m_csv.getColumn(colName)[rowIndex];
-                        if (!cellValue.empty()) {
-                            keepRow = true;
-                            break;
-                        }
-                    } catch (const std::exception& e) {
-                        // Continue checking other columns
-                    }
-                }
-            } else {
-                throw std::invalid_argument("Invalid 'how' parameter: must be 'any' or 'all'");
-            }
-
-            if (keepRow) {
-                rowsToKeep.push_back(rowIndex);
-            }
+        if (how != "any" && how != "all") {
+            throw std::invalid_argument("Invalid 'how' parameter: must be 'any' or 'all'");
         }
 
-        // Create new data with only rows to keep
-        CSV::DataFrame newData;
-        newData.reserve(rowsToKeep.size());
-
-        for (size_t index : rowsToKeep) {
-            newData.push_back(m_csv.getRow(index));
+        std::vector<const Bitmap*> validity;
+        validity.reserve(columnsToCheck.size());
+        for (const auto& colName : columnsToCheck) {
+            validity.push_back(&column(colName).validity());
         }
 
-        // Create a new CSV with the same headers but filtered data
-        CSV newCSV;
+        // Combine the validity bitmaps 64 rows at a time, in row chunks:
+        // "any" keeps rows valid in every column (AND), "all" rows valid in some column (OR)
+        const bool requireAll = how == "any";
+        Bitmap keep(rowCount(), requireAll);
+        policy.forEachChunk(rowCount(), validity.size(), [&](size_t begin, size_t end) {
+            for (size_t w = begin / 64; w < Bitmap::wordCount(end); ++w) {
+                uint64_t word = keep.words()[w];
+                for (const Bitmap* columnValidity : validity) {
+                    word = requireAll ? (word & columnValidity->words()[w]) : (word | columnValidity->words()[w]);
+                }
+                keep.setWord(w, word);
+            }
+        });
 
-        // Set up a temporary CSV file to load from
-        std::string tempFilename = "temp_dropna_" + std::to_string(reinterpret_cast<uintptr_t>(this)) + ".csv";
-        std::ofstream tempFile(tempFilename);
+        std::vector<size_t> rowsToKeep = keep.setBits();
+        return take(rowsToKeep, policy);
+    }
 
-        // Write headers
-        for (size_t i = 0; i < m_csv.headers().size(); ++i) {
-            if (i > 0) tempFile << m_csv.getDelimiter();
-            tempFile << m_csv.headers()[i];
-        }
-        tempFile << "\n";
+    /**
+     * @brief Conta os valores não nulos de uma coluna
+     * @param columnName Nome da coluna
+     * @return Número de valores não nulos
+     */
+    size_t count(const std::string& columnName) const {
+        return column(columnName).validity().count();
+    }
 
-        // Write filtered data
-        for (const auto& row : newData) {
-            for (size_t i = 0; i < row.size(); ++i) {
-                if (i > 0) tempFile << m_csv.getDelimiter();
-                tempFile << row[i];
-            }
-            tempFile << "\n";
+    /**
+     * @brief Conta os valores não nulos de cada coluna ativa (como df.count() do pandas)
+     * @return Uma contagem por coluna ativa, na ordem das colunas
+     */
+    std::vector<size_t> count() const {
+        std::vector<size_t> counts;
+        counts.reserve(m_columnIndices.size());
+        for (size_t i = 0; i < m_columnIndices.size(); ++i) {
+            counts.push_back(column(i).validity().count());
         }
+        return counts;
+    }
 
-        tempFile.close();
-
-        // Load the CSV file to properly initialize all CSV internals
-        newCSV.load(tempFilename, true, m_csv.getDelimiter());
+    /**
+     * @brief Obtém a máscara de valores nulos de uma coluna
+     * @param columnName Nome da coluna
+     * @return Bit i = 1 se o valor da linha i for nulo
+     */
+    Bitmap isna(const std::string& columnName) const {
+        return ~column(columnName).validity();
+    }
 
-        // Clean up the temporary file
-        std::remove(tempFilename.c_str());
+    /**
+     * @brief Obtém a máscara de valores não nulos de uma coluna
+     * @param columnName Nome da coluna
+     * @return Bit i = 1 se o valor da linha i não for nulo
+     */
+    Bitmap notna(const std::string& columnName) const {
+        return column(columnName).validity();
+    }
 
-        // Create result DataFrame
-        DataFrame filteredDF(newCSV);
-        filteredDF.m_activeColumns = m_activeColumns;
+    /**
+     * @brief Indica os valores nulos de cada coluna ativa (como df.isna() do pandas)
+     * @return DataFrame de colunas bool com os mesmos nomes
+     */
+    DataFrame isna() const {
+        return nullMask(true);
+    }
 
-        return filteredDF;
+    /**
+     * @brief Indica os valores não nulos de cada coluna ativa (como df.notna() do pandas)
+     * @return DataFrame de colunas bool com os mesmos nomes
+     */
+    DataFrame notna() const {
+        return nullMask(false);
     }
 
     /**
@@ -696,14 +1027,8 @@ public:
      * @return Valor double ou NaN se a conversão falhar
      */
     static double toDouble(const std::string& str) {
-        try {
-            if (str.empty()) {
-                return std::numeric_limits<double>::quiet_NaN();
-            }
-            return std::stod(str);
-        } catch (...) {
-            return std::numeric_limits<double>::quiet_NaN();
-        }
+        ParseResult<double> parsed = parseDouble(str);
+        return parsed.ok() ? parsed.value : std::numeric_limits<double>::quiet_NaN();
     }
 
     /**
@@ -712,14 +1037,19 @@ public:
      * @return Vetor de valores numéricos
      */
     std::vector<double> columnToNumeric(const CSV::Column& column) const {
-        std::vector<double> numericValues;
-        numericValues.reserve(column.size());
-
-        for (const auto& value : column) {
-            numericValues.push_back(toDouble(value));
-        }
+        return toNumeric(std::span<const std::string>(column)).values;
+    }
 
-        return numericValues;
+    /**
+     * @brief Reduz uma coluna numérica em uma única varredura vetorizada
+     * @param columnName Nome da coluna
+     * @return Contagem, soma, soma dos quadrados, mínimo e máximo dos valores válidos
+     *         (contagem zero se a coluna não for numérica)
+     */
+    Reduction reduction(const std::string& columnName) const {
+        return column(columnName).visitNumeric([](auto values) {
+            return CPPandas::reduce(values);
+        }, Reduction{});
     }
 
     /**
@@ -728,21 +1058,7 @@ public:
      * @return Média dos valores
      */
     double mean(const std::string& columnName) const {
-        auto column = getColumn(columnName);
-        auto numericValues = columnToNumeric(column);
-
-        // Contar valores não-NaN
-        size_t count = 0;
-        double sum = 0.0;
-
-        for (double value : numericValues) {
-            if (!std::isnan(value)) {
-                sum += value;
-                count++;
-            }
-        }
-
-        return count > 0 ? sum / count : std::numeric_limits<double>::quiet_NaN();
+        return reduction(columnName).mean();
     }
 
     /**
@@ -751,27 +1067,7 @@ public:
      * @return Variância dos valores
      */
     double var(const std::string& columnName) const {
-        auto column = getColumn(columnName);
-        auto numericValues = columnToNumeric(column);
-
-        double meanValue = mean(columnName);
-        if (std::isnan(meanValue)) {
-            return std::numeric_limits<double>::quiet_NaN();
-        }
-
-        // Calcular variância
-        size_t count = 0;
-        double sumSquares = 0.0;
-
-        for (double value : numericValues) {
-            if (!std::isnan(value)) {
-                double diff = value - meanValue;
-                sumSquares += diff * diff;
-                count++;
-            }
-        }
-
-        return count > 1 ? sumSquares / (count - 1) : std::numeric_limits<double>::quiet_NaN();
+        return reduction(columnName).variance();
     }
 
     /**
@@ -780,8 +1076,7 @@ public:
      * @return Desvio padrão dos valores
      */
     double std(const std::string& columnName) const {
-        double variance = var(columnName);
-        return std::isnan(variance) ? variance : std::sqrt(variance);
+        return reduction(columnName).stddev();
     }
 
     /**
@@ -790,20 +1085,7 @@ public:
      * @return Valor mínimo
      */
     double min(const std::string& columnName) const {
-        auto column = getColumn(columnName);
-        auto numericValues = columnToNumeric(column);
-
-        double minValue = std::numeric_limits<double>::infinity();
-        bool hasValidValue = false;
-
-        for (double value : numericValues) {
-            if (!std::isnan(value)) {
-                minValue = std::min(minValue, value);
-                hasValidValue = true;
-            }
-        }
-
-        return hasValidValue ? minValue : std::numeric_limits<double>::quiet_NaN();
+        return reduction(columnName).min;
     }
 
     /**
@@ -812,24 +1094,15 @@ public:
      * @return Valor máximo
      */
     double max(const std::string& columnName) const {
-        auto column = getColumn(columnName);
-        auto numericValues = columnToNumeric(column);
-
-        double maxValue = -std::numeric_limits<double>::infinity();
-        bool hasValidValue = false;
-
-        for (double value : numericValues) {
-            if (!std::isnan(value)) {
-                maxValue = std::max(maxValue, value);
-                hasValidValue = true;
-            }
-        }
-
-        return hasValidValue ? maxValue : std::numeric_limits<double>::quiet_NaN();
+        return reduction(columnName).max;
     }
 
     /**
      * @brief Calcula o quantil de uma coluna numérica
+     *
+     * Usa seleção em O(n) na primeira consulta à coluna; consultas
+     * seguintes usam a ordenação mantida em cache pela coluna.
+     *
      * @param columnName Nome da coluna
      * @param q Valor do quantil (entre 0 e 1)
      * @return Valor do quantil
@@ -838,93 +1111,221 @@ public:
         if (q < 0.0 || q > 1.0) {
             throw std::invalid_argument("Quantile value must be between 0 and 1");
         }
+        return column(columnName).quantiles(std::span<const double>(&q, 1))[0];
+    }
 
-        auto column = getColumn(columnName);
-        auto numericValues = columnToNumeric(column);
+    /**
+     * @brief Calcula vários quantis de uma coluna numérica de uma só vez
+     * @param columnName Nome da coluna
+     * @param qs Valores dos quantis (entre 0 e 1)
+     * @return Quantis na ordem pedida
+     * @throws std::invalid_argument se algum quantil estiver fora de [0, 1]
+     */
+    std::vector<double> quantile(const std::string& columnName, const std::vector<double>& qs) const {
+        return column(columnName).quantiles(qs);
+    }
 
-        // Filtrar valores NaN
-        std::vector<double> validValues;
-        validValues.reserve(numericValues.size());
+    /**
+     * @brief Erro de posição padrão dos quantis aproximados (1%)
+     */
+    static constexpr double kDefaultSketchAccuracy = 0.01;
 
-        for (double value : numericValues) {
-            if (!std::isnan(value)) {
-                validValues.push_back(value);
-            }
+    /**
+     * @brief Resume uma coluna numérica em um TDigest
+     *
+     * Os blocos de linhas são resumidos em paralelo (conforme @p policy) e
+     * combinados com TDigest::merge(). O resumo pode ser combinado com os de
+     * outros DataFrames, por exemplo blocos de um arquivo lidos em sequência.
+     *
+     * @param columnName Nome da coluna
+     * @param accuracy Erro de posição aproximado, como fração do total (ex.: 0.01 = 1%)
+     * @param policy Execução sequencial ou paralela (blocos de linhas)
+     * @return Resumo dos valores válidos (vazio se a coluna não for numérica)
+     * @throws std::invalid_argument se accuracy não estiver em (0, 1)
+     */
+    TDigest sketch(const std::string& columnName, double accuracy = kDefaultSketchAccuracy,
+                   const ExecutionPolicy& policy = ExecutionPolicy()) const {
+        TDigest digest = TDigest::forAccuracy(accuracy);
+        const ColumnBuffer& values = column(columnName);
+        if (!values.isNumeric()) {
+            return digest;
         }
 
-        if (validValues.empty()) {
-            return std::numeric_limits<double>::quiet_NaN();
+        std::mutex partsMutex;
+        std::vector<std::pair<size_t, TDigest>> parts;
+        policy.forEachChunk(values.size(), 1, [&](size_t begin, size_t end) {
+            TDigest part = TDigest::forAccuracy(accuracy);
+            values.visitNumeric([&](auto data) {
+                for (auto raw : data.subspan(begin, end - begin)) {
+                    part.add(static_cast<double>(raw));
+                }
+                return 0;
+            }, 0);
+            part.compress();
+            std::lock_guard<std::mutex> lock(partsMutex);
+            parts.emplace_back(begin, std::move(part));
+        });
+
+        // Combinar na ordem das linhas, para um resultado determinístico
+        std::sort(parts.begin(), parts.end(), [](const auto& a, const auto& b) {
+            return a.first < b.first;
+        });
+        for (const auto& part : parts) {
+            digest.merge(part.second);
         }
+        return digest;
+    }
 
-        // Ordenar valores
-        std::sort(validValues.begin(), validValues.end());
-
-        // Calcular índice
-        double index = q * (validValues.size() - 1);
-        size_t lowerIndex = static_cast<size_t>(index);
-        size_t upperIndex = std::min(lowerIndex + 1, validValues.size() - 1);
-        double fraction = index - lowerIndex;
+    /**
+     * @brief Calcula quantis aproximados de uma coluna numérica
+     *
+     * Usa um TDigest (sketch()) em vez de copiar e reordenar a coluna: a
+     * memória usada é limitada por 1 / accuracy centroides.
+     *
+     * @param columnName Nome da coluna
+     * @param qs Valores dos quantis (entre 0 e 1)
+     * @param accuracy Erro de posição aproximado, como fração do total (ex.: 0.01 = 1%)
+     * @param policy Execução sequencial ou paralela (blocos de linhas)
+     * @return Quantis aproximados na ordem pedida
+     * @throws std::invalid_argument se algum quantil ou accuracy for inválido
+     */
+    std::vector<double> approx_quantile(const std::string& columnName, const std::vector<double>& qs,
+                                        double accuracy = kDefaultSketchAccuracy,
+                                        const ExecutionPolicy& policy = ExecutionPolicy()) const {
+        for (double q : qs) {
+            if (q < 0.0 || q > 1.0) {
+                throw std::invalid_argument("Quantile value must be between 0 and 1");
+            }
+        }
+        return sketch(columnName, accuracy, policy).quantiles(qs);
+    }
 
-        // Interpolar
-        return validValues[lowerIndex] + fraction * (validValues[upperIndex] - validValues[lowerIndex]);
+    /**
+     * @brief Calcula a mediana de uma coluna numérica
+     * @param columnName Nome da coluna
+     * @return Mediana dos valores
+     */
+    double median(const std::string& columnName) const {
+        return quantile(columnName, 0.5);
     }
 
     /**
      * @brief Calcula os quantis para todas as colunas
      * @param q Valor do quantil (entre 0 e 1)
+     * @param policy Execução sequencial ou paralela (uma tarefa por coluna)
      * @return Vetor de valores de quantil para cada coluna ativa
      */
-    std::vector<double> quantile(double q) const {
-        std::vector<double> result;
-        result.reserve(m_activeColumns.size());
-
-        for (const auto& colName : m_activeColumns) {
-            result.push_back(quantile(colName, q));
-        }
+    std::vector<double> quantile(double q, const ExecutionPolicy& policy = ExecutionPolicy()) const {
+        std::vector<double> result(m_activeColumns.size());
+        policy.forEach(result.size(), rowCount() * result.size(), [&](size_t i) {
+            result[i] = quantile(m_activeColumns[i], q);
+        });
 
         return result;
     }
 
     /**
      * @brief Encontra a moda (valor mais frequente) de uma coluna
+     *
+     * Em caso de empate, retorna o menor dos valores mais frequentes.
+     *
      * @param columnName Nome da coluna
-     * @return Moda da coluna
+     * @param policy Execução sequencial ou paralela (blocos de linhas)
+     * @return Moda da coluna (NaN se ela não for numérica ou não tiver valores)
      */
-    double mode(const std::string& columnName) const {
-        auto column = getColumn(columnName);
-        auto numericValues = columnToNumeric(column);
-
-        // Contar frequências
-        std::map<double, size_t> frequencies;
+    double mode(const std::string& columnName, const ExecutionPolicy& policy) const {
+        const ColumnBuffer& values = column(columnName);
+        if (!values.isNumeric()) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
 
-        for (double value : numericValues) {
-            if (!std::isnan(value)) {
-                frequencies[value]++;
+        double modeValue = std::numeric_limits<double>::quiet_NaN();
+        size_t maxFrequency = 0;
+        for (const ValueFrequency& frequency : countValues(values, policy)) {
+            double value = values.getDouble(frequency.firstRow);
+            if (frequency.count > maxFrequency || (frequency.count == maxFrequency && value < modeValue)) {
+                modeValue = value;
+                maxFrequency = frequency.count;
             }
         }
+        return modeValue;
+    }
 
-        if (frequencies.empty()) {
-            return std::numeric_limits<double>::quiet_NaN();
-        }
+    /**
+     * @brief Encontra a moda (valor mais frequente) de uma coluna
+     * @param columnName Nome da coluna
+     * @return Moda da coluna
+     */
+    double mode(const std::string& columnName) const {
+        return mode(columnName, ExecutionPolicy());
+    }
 
-        // Encontrar valor mais frequente
-        double modeValue = frequencies.begin()->first;
-        size_t maxFrequency = frequencies.begin()->second;
+    /**
+     * @brief Conta as ocorrências de cada valor de uma coluna (como value_counts() do pandas)
+     *
+     * Os valores nulos são ignorados. Os valores são ordenados pela
+     * contagem, do maior para o menor, e os empates pela primeira ocorrência.
+     *
+     * @param columnName Nome da coluna
+     * @param normalize Se true, retorna proporções em vez de contagens
+     * @param topk Número máximo de valores retornados (0 = todos)
+     * @param policy Execução sequencial ou paralela (blocos de linhas)
+     * @return Valores e contagens
+     */
+    ValueCounts value_counts(const std::string& columnName, bool normalize = false, size_t topk = 0,
+                             const ExecutionPolicy& policy = ExecutionPolicy()) const {
+        const ColumnBuffer& values = column(columnName);
+        std::vector<ValueFrequency> frequencies = countValues(values, policy);
+
+        auto moreFrequent = [](const ValueFrequency& a, const ValueFrequency& b) {
+            return a.count != b.count ? a.count > b.count : a.firstRow < b.firstRow;
+        };
+        size_t limit = topk == 0 ? frequencies.size() : std::min(topk, frequencies.size());
+        std::partial_sort(frequencies.begin(), frequencies.begin() + limit, frequencies.end(), moreFrequent);
+
+        double total = static_cast<double>(values.size() - values.nullCount());
+        ValueCounts result;
+        result.values.reserve(limit);
+        result.counts.reserve(limit);
+        for (size_t i = 0; i < limit; ++i) {
+            result.values.push_back(values.getString(frequencies[i].firstRow));
+            double count = static_cast<double>(frequencies[i].count);
+            result.counts.push_back(normalize ? count / total : count);
+        }
+        return result;
+    }
 
-        for (const auto& pair : frequencies) {
-            if (pair.second > maxFrequency) {
-                modeValue = pair.first;
-                maxFrequency = pair.second;
-            }
+    /**
+     * @brief Obtém os valores distintos de uma coluna, na ordem em que aparecem
+     * @param columnName Nome da coluna
+     * @param policy Execução sequencial ou paralela (blocos de linhas)
+     * @return Valores distintos não nulos
+     */
+    std::vector<std::string> unique(const std::string& columnName,
+                                    const ExecutionPolicy& policy = ExecutionPolicy()) const {
+        const ColumnBuffer& values = column(columnName);
+        std::vector<std::string> result;
+        for (const ValueFrequency& frequency : countValues(values, policy)) {
+            result.push_back(values.getString(frequency.firstRow));
         }
+        return result;
+    }
 
-        return modeValue;
+    /**
+     * @brief Conta os valores distintos de uma coluna
+     * @param columnName Nome da coluna
+     * @param policy Execução sequencial ou paralela (blocos de linhas)
+     * @return Número de valores distintos não nulos
+     */
+    size_t nunique(const std::string& columnName, const ExecutionPolicy& policy = ExecutionPolicy()) const {
+        return countValues(column(columnName), policy).size();
     }
 
     /**
  * @brief Extensão da classe DataFrame para criar histogramas
  */
-    void hist(int bins = 30, const std::string& filename = "") const {
+    void hist(int bins = 30, const std::string& filename = "",
+              const ExecutionPolicy& policy = ExecutionPolicy()) const {
         // Gerar nome de arquivo automático se não for fornecido
         std::string outputFile = filename;
         if (outputFile.empty()) {
@@ -936,42 +1337,33 @@ public:
         std::vector<std::string> colNames;
 
         // Determinar colunas numéricas
-        for (const auto& colName : m_activeColumns) {
-            auto column = getColumn(colName);
-
-            // Verificar se a coluna é numérica (pelo menos 70% dos valores não vazios são numéricos)
-            size_t numericCount = 0;
-            size_t nonEmptyCount = 0;
-
-            for (const auto& value : column) {
-                if (!value.empty()) {
-                    nonEmptyCount++;
-                    try {
-                        std::stod(value);
-                        numericCount++;
-                    } catch (...) {
-                        // Não é numérico
-                    }
-                }
+        std::vector<std::string> numericColumns;
+        const Schema columnTypes = schema();
+        for (const auto& [colName, type] : columnTypes.fields()) {
+            if (type == DType::Float64 || type == DType::Int64) {
+                numericColumns.push_back(colName);
             }
+        }
 
-            double numericRatio = nonEmptyCount > 0 ? static_cast<double>(numericCount) / nonEmptyCount : 0.0;
-
-            if (numericRatio >= 0.7) {
-                auto numericValues = columnToNumeric(column);
-
-                // Filtrar valores NaN
-                std::vector<double> validValues;
-                for (double value : numericValues) {
-                    if (!std::isnan(value)) {
-                        validValues.push_back(value);
-                    }
+        // Extrair os valores válidos de cada coluna, uma tarefa por coluna
+        std::vector<std::vector<double>> columnValues(numericColumns.size());
+        policy.forEach(numericColumns.size(), rowCount() * numericColumns.size(), [&](size_t i) {
+            NumericBuffer numeric = column(numericColumns[i]).toNumeric();
+
+            // Filtrar valores nulos
+            std::vector<double>& validValues = columnValues[i];
+            validValues.reserve(numeric.validCount);
+            for (size_t j = 0; j < numeric.values.size(); ++j) {
+                if (numeric.valid[j]) {
+                    validValues.push_back(numeric.values[j]);
                 }
+            }
+        });
 
-                if (!validValues.empty()) {
-                    histData.push_back(validValues);
-                    colNames.push_back(colName);
-                }
+        for (size_t i = 0; i < numericColumns.size(); ++i) {
+            if (!columnValues[i].empty()) {
+                histData.push_back(std::move(columnValues[i]));
+                colNames.push_back(numericColumns[i]);
             }
         }
 
@@ -1067,22 +1459,51 @@ private:
     std::vector<double> m_stds;
     bool m_fitted;
 
+    void checkFitted(const DataFrame& df) const {
+        if (!m_fitted) {
+            throw std::runtime_error("StandardScaler não foi ajustado. Chame fit() primeiro.");
+        }
+
+        if (df.headers().size() != m_means.size()) {
+            throw std::invalid_argument("O número de colunas no DataFrame não corresponde ao que foi usado no fit()");
+        }
+    }
+
+    // Padroniza as linhas [begin, begin + out.size()) de uma coluna em out (que pode ser a própria coluna);
+    // valores NaN, colunas não numéricas e colunas constantes resultam em NaN
+    void scaleRange(const ColumnBuffer& values, size_t colIdx, size_t begin, std::span<double> out) const {
+        if (!values.isNumeric() || m_stds[colIdx] == 0) {
+            std::fill(out.begin(), out.end(), std::numeric_limits<double>::quiet_NaN());
+            return;
+        }
+        values.visitNumeric([&](auto data) {
+            standardize(data.subspan(begin, out.size()), m_means[colIdx], m_stds[colIdx], out);
+            return 0;
+        }, 0);
+    }
+
 public:
     StandardScaler() : m_fitted(false) {}
 
     /**
      * @brief Calcula as médias e desvios padrão das colunas
      * @param df DataFrame com os dados a serem analisados
+     * @param policy Execução sequencial ou paralela (uma tarefa por coluna)
      * @return Referência para este objeto para permitir encadeamento de métodos
      */
-    StandardScaler& fit(const DataFrame& df) {
-        m_means.clear();
-        m_stds.clear();
-
-        for (const auto& colName : df.headers()) {
-            m_means.push_back(df.mean(colName));
-            m_stds.push_back(df.std(colName));
-        }
+    StandardScaler& fit(const DataFrame& df, const ExecutionPolicy& policy = ExecutionPolicy()) {
+        // Colunas não numéricas (pelo esquema) não são normalizadas
+        const std::vector<std::string>& columns = df.headers();
+        m_means.assign(columns.size(), std::numeric_limits<double>::quiet_NaN());
+        m_stds.assign(columns.size(), std::numeric_limits<double>::quiet_NaN());
+
+        policy.forEach(columns.size(), df.rowCount() * columns.size(), [&](size_t i) {
+            if (df.column(i).isNumeric()) {
+                Reduction moments = df.reduction(columns[i]);
+                m_means[i] = moments.mean();
+                m_stds[i] = moments.stddev();
+            }
+        });
 
         m_fitted = true;
         return *this;
@@ -1090,83 +1511,100 @@ public:
 
     /**
      * @brief Normaliza os dados usando as estatísticas já calculadas
+     *
+     * Os valores são lidos diretamente dos buffers numéricos e escritos em
+     * colunas float64 por um kernel vetorizado (standardize()), sem passar
+     * por texto.
+     *
      * @param df DataFrame com os dados a serem normalizados
+     * @param policy Execução sequencial ou paralela (blocos de linhas)
      * @return Novo DataFrame com os dados normalizados
      */
-    DataFrame transform(const DataFrame& df) const {
-        if (!m_fitted) {
-            throw std::runtime_error("StandardScaler não foi ajustado. Chame fit() primeiro.");
-        }
+    DataFrame transform(const DataFrame& df, const ExecutionPolicy& policy = ExecutionPolicy()) const {
+        checkFitted(df);
 
-        if (df.headers().size() != m_means.size()) {
-            throw std::invalid_argument("O número de colunas no DataFrame não corresponde ao que foi usado no fit()");
+        // O resultado é montado coluna a coluna, em memória, a partir dos valores tipados
+        std::vector<std::vector<double>> scaled(m_means.size());
+        for (auto& values : scaled) {
+            values.resize(df.rowCount());
         }
 
-        // Criar um CSV temporário para o resultado
-        CSV::DataFrame transformedData;
-        transformedData.reserve(df.rowCount());
-
-        for (size_t rowIdx = 0; rowIdx < df.rowCount(); ++rowIdx) {
-            CSV::Row row = df.getRow(rowIdx);
-            CSV::Row transformedRow;
-
-            for (size_t colIdx = 0; colIdx < row.size(); ++colIdx) {
-                double value = DataFrame::toDouble(row[colIdx]);
-
-                if (std::isnan(value) || m_stds[colIdx] == 0) {
-                    transformedRow.push_back("");  // Manter NaN ou não-numérico como NaN
-                } else {
-                    double scaledValue = (value - m_means[colIdx]) / m_stds[colIdx];
-                    // Converter para string com precisão controlada
-                    std::ostringstream ss;
-                    ss << std::fixed << std::setprecision(6) << scaledValue;
-                    transformedRow.push_back(ss.str());
-                }
+        // Cada tarefa padroniza um intervalo de linhas de uma coluna
+        policy.forEachChunk(df.rowCount(), m_means.size(), [&](size_t begin, size_t end) {
+            for (size_t colIdx = 0; colIdx < m_means.size(); ++colIdx) {
+                std::span<double> out = std::span<double>(scaled[colIdx]).subspan(begin, end - begin);
+                scaleRange(df.column(colIdx), colIdx, begin, out);
             }
+        });
 
-            transformedData.push_back(transformedRow);
+        std::vector<ColumnBuffer> transformedColumns;
+        transformedColumns.reserve(scaled.size());
+        for (auto& values : scaled) {
+            transformedColumns.push_back(ColumnBuffer::fromFloat64(std::move(values)));
         }
+        return DataFrame::fromColumns(df.headers(), std::move(transformedColumns));
+    }
 
-        // Criar um CSV temporário com os dados transformados
-        std::string tempFilename = "temp_scaled_" + std::to_string(reinterpret_cast<uintptr_t>(this)) + ".csv";
-        std::ofstream file(tempFilename);
-
-        // Escrever cabeçalho
-        for (size_t i = 0; i < df.headers().size(); ++i) {
-            if (i > 0) file << ',';
-            file << df.headers()[i];
-        }
-        file << '\n';
+    /**
+     * @brief Ajusta e transforma em uma única operação
+     * @param df DataFrame com os dados a serem ajustados e transformados
+     * @param policy Execução sequencial ou paralela (uma tarefa por coluna)
+     * @return Novo DataFrame com os dados normalizados
+     */
+    DataFrame fit_transform(const DataFrame& df, const ExecutionPolicy& policy = ExecutionPolicy()) {
+        fit(df, policy);
+        return transform(df, policy);
+    }
 
-        // Escrever dados transformados
-        for (const auto& row : transformedData) {
-            for (size_t i = 0; i < row.size(); ++i) {
-                if (i > 0) file << ',';
-                file << row[i];
+    /**
+     * @brief Normaliza os dados em lugar, sem criar uma segunda tabela
+     *
+     * Colunas float64 são sobrescritas nos próprios buffers; as demais
+     * (int64, bool e não numéricas) são substituídas por colunas float64.
+     * Cópias de @p df feitas antes da chamada continuam com os valores
+     * originais: só os valores compartilhados com elas são copiados.
+     *
+     * @param df DataFrame com os dados a serem normalizados
+     * @param policy Execução sequencial ou paralela (blocos de linhas)
+     * @return Referência para @p df
+     */
+    DataFrame& transform_inplace(DataFrame& df, const ExecutionPolicy& policy = ExecutionPolicy()) const {
+        checkFitted(df);
+
+        for (size_t colIdx = 0; colIdx < m_means.size(); ++colIdx) {
+            const ColumnBuffer& values = df.column(colIdx);
+            if (values.dtype() == DType::Float64) {
+                df.updateFloat64(colIdx, [&](std::span<double> data) {
+                    policy.forEachChunk(data.size(), 1, [&](size_t begin, size_t end) {
+                        std::span<double> range = data.subspan(begin, end - begin);
+                        if (m_stds[colIdx] == 0) {
+                            std::fill(range.begin(), range.end(), std::numeric_limits<double>::quiet_NaN());
+                        } else {
+                            standardize(range, m_means[colIdx], m_stds[colIdx], range);
+                        }
+                    });
+                });
+                continue;
             }
-            file << '\n';
-        }
-
-        file.close();
 
-        // Carregar como novo DataFrame
-        CSV csv;
-        csv.load(tempFilename);
-
-        // Remover o arquivo temporário
-        std::remove(tempFilename.c_str());
-
-        return DataFrame(csv);
+            std::vector<double> scaled(df.rowCount());
+            policy.forEachChunk(scaled.size(), 1, [&](size_t begin, size_t end) {
+                scaleRange(values, colIdx, begin, std::span<double>(scaled).subspan(begin, end - begin));
+            });
+            df.setColumn(colIdx, ColumnBuffer::fromFloat64(std::move(scaled)));
+        }
+        return df;
     }
 
     /**
-     * @brief Ajusta e transforma em uma única operação
-     * @param df DataFrame com os dados a serem ajustados e transformados
-     * @return Novo DataFrame com os dados normalizados
+     * @brief Ajusta e normaliza em lugar (ver transform_inplace())
+     * @param df DataFrame com os dados a serem ajustados e normalizados
+     * @param policy Execução sequencial ou paralela
+     * @return Referência para @p df
      */
-    DataFrame fit_transform(const DataFrame& df) {
-        fit(df);
-        return transform(df);
+    DataFrame& fit_transform_inplace(DataFrame& df, const ExecutionPolicy& policy = ExecutionPolicy()) {
+        fit(df, policy);
+        return transform_inplace(df, policy);
     }
 };
 
@@ -1198,14 +1636,14 @@ public:
         std::vector<std::string> labels;
 
         for (const auto& colName : df.headers()) {
-            auto column = df.getColumn(colName);
-            std::vector<double> numericValues = df.columnToNumeric(column);
+            NumericBuffer numericValues = df.columnView(colName).toNumeric();
 
-            // Filtrar valores NaN
+            // Filtrar valores inválidos
             std::vector<double> validValues;
-            for (double value : numericValues) {
-                if (!std::isnan(value)) {
-                    validValues.push_back(value);
+            validValues.reserve(numericValues.validCount);
+            for (size_t i = 0; i < numericValues.values.size(); ++i) {
+                if (numericValues.valid[i]) {
+                    validValues.push_back(numericValues.values[i]);
                 }
             }
 
@@ -1276,11 +1714,108 @@ public:
     }
 };
 
+/**
+ * @class DataFrameChunkReader
+ * @brief Leitura de um arquivo CSV em lotes, cada um entregue como um DataFrame
+ *
+ * Exemplo:
+ * @code
+ * auto reader = CPPandas::read_csv_chunked("dados.csv", 100000);
+ * DataFrame chunk;
+ * while (reader.next(chunk)) {
+ *     total += chunk.rowCount();
+ * }
+ * @endcode
+ */
+class DataFrameChunkReader {
+public:
+    DataFrameChunkReader(const std::string& filename, size_t chunkSize, const ReadOptions& options = ReadOptions())
+        : m_reader(std::make_unique<CSV::ChunkReader>(filename, chunkSize, options)) {}
+
+    bool isOpen() const { return m_reader->isOpen(); }
+
+    const std::vector<std::string>& headers() const { return m_reader->headers(); }
+
+    size_t rowsRead() const { return m_reader->rowsRead(); }
+
+    /**
+     * @brief Obtém os tipos das colunas até o último lote lido (ver CSV::ChunkReader::schema())
+     * @return Esquema
+     */
+    const Schema& schema() const { return m_reader->schema(); }
+
+    /**
+     * @brief Lê o próximo lote
+     * @param chunk DataFrame que recebe o lote
+     * @return true se algum dado foi lido, false ao fim do arquivo
+     */
+    bool next(DataFrame& chunk) {
+        if (!m_reader->next(m_batch)) {
+            return false;
+        }
+        chunk = DataFrame(std::move(m_batch));
+        m_batch = CSV();
+        return true;
+    }
+
+private:
+    std::unique_ptr<CSV::ChunkReader> m_reader;
+    CSV m_batch;
+};
+
 class CPPandas {
 public:
+    /**
+     * @brief Lê um arquivo CSV, convertendo cada coluna para o seu tipo uma única vez
+     * @param filename Nome do arquivo CSV a ser lido
+     * @param hasHeader Se o arquivo possui uma linha de cabeçalho
+     * @param delimiter Caractere delimitador dos campos
+     * @return DataFrame com colunas tipadas
+     */
     static DataFrame read_csv(const std::string& filename, bool hasHeader = true, char delimiter = ',') {
         CSV csv(filename, hasHeader, delimiter);
-        return DataFrame(csv);
+        return DataFrame(std::move(csv));
+    }
+
+    /**
+     * @brief Lê um arquivo CSV com opções de leitura (por exemplo, mapeamento em memória)
+     * @param filename Nome do arquivo CSV a ser lido
+     * @param options Opções de leitura
+     * @return DataFrame com colunas tipadas
+     */
+    static DataFrame read_csv(const std::string& filename, const ReadOptions& options) {
+        CSV csv(filename, options);
+        return DataFrame(std::move(csv));
+    }
+
+    /**
+     * @brief Abre um arquivo salvo por DataFrame::to_binary() mapeando-o em memória
+     *
+     * Não há conversão de texto: as colunas numéricas referenciam o arquivo
+     * mapeado e só são lidas do disco quando acessadas.
+     *
+     * @param filename Nome do arquivo
+     * @return DataFrame com as colunas do arquivo
+     * @throws std::runtime_error se o arquivo não puder ser aberto ou não estiver no formato binário
+     */
+    static DataFrame read_binary(const std::string& filename) {
+        CSV csv;
+        if (!csv.loadBinary(filename)) {
+            throw std::runtime_error("Cannot read binary file: " + filename);
+        }
+        return DataFrame(std::move(csv));
+    }
+
+    /**
+     * @brief Lê um arquivo CSV em lotes de linhas, sem carregá-lo inteiro na memória
+     * @param filename Nome do arquivo CSV a ser lido
+     * @param chunkSize Número máximo de linhas por lote
+     * @param options Opções de leitura
+     * @return Leitor que produz um DataFrame por lote
+     */
+    static DataFrameChunkReader read_csv_chunked(const std::string& filename, size_t chunkSize,
+                                                 const ReadOptions& options = ReadOptions()) {
+        return DataFrameChunkReader(filename, chunkSize, options);
     }
 };
 
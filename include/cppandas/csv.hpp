@@ -7,16 +7,130 @@
 #ifndef CPPANDAS_CSV_HPP
 #define CPPANDAS_CSV_HPP
 
+#include "cppandas/column.hpp"
+#include "cppandas/schema.hpp"
 #include <string>
 #include <vector>
 #include <unordered_map>
 #include <memory>
+#include <mutex>
 #include <fstream>
+#include <span>
+#include <string_view>
 
 namespace CPPandas {
 
+namespace detail {
+class StringArena;
+} // namespace detail
+
 using VectorStr = std::vector<std::string>;
 
+/**
+ * @brief Opções de leitura de arquivos CSV
+ *
+ * Campos entre aspas seguem a RFC 4180: podem conter delimitadores e
+ * quebras de linha, e aspas internas são escritas em dobro ("").
+ */
+struct ReadOptions {
+    bool hasHeader = true;   ///< Se o arquivo possui uma linha de cabeçalho
+    char delimiter = ',';    ///< Caractere delimitador dos campos
+
+    /**
+     * @brief Mapear o arquivo em memória em vez de copiá-lo
+     *
+     * As colunas de texto passam a referenciar diretamente o mapeamento,
+     * que permanece vivo enquanto alguma delas existir.
+     */
+    bool memoryMap = false;
+
+    /**
+     * @brief Número de threads usadas na leitura (0 = pool compartilhado, ThreadPool::global())
+     *
+     * Com mais de uma thread, o arquivo é dividido em blocos alinhados a
+     * quebras de linha, processados em paralelo e reunidos em ordem.
+     * Arquivos pequenos são sempre lidos por uma única thread.
+     */
+    size_t numThreads = 1;
+
+    /**
+     * @brief Número de linhas examinadas para inferir o tipo de cada coluna (0 = todas)
+     *
+     * A amostra é espaçada uniformemente pelo arquivo. Se algum valor fora
+     * da amostra não couber no tipo inferido, a coluna recebe o próximo
+     * tipo mais amplo, de modo que nenhum valor é perdido.
+     */
+    size_t inferenceRows = 0;
+
+    /**
+     * @brief Tipos explícitos por nome de coluna, dispensando a inferência
+     *
+     * Colunas ausentes do esquema são inferidas. Em arquivos sem cabeçalho,
+     * as colunas são identificadas pela posição ("0", "1", ...). Valores que
+     * não podem ser convertidos para o tipo explícito tornam-se nulos.
+     */
+    Schema schema;
+
+    /**
+     * @brief Nomes das colunas a serem lidas (vazio = todas)
+     *
+     * Os campos das demais colunas são descartados pelo tokenizador, sem
+     * serem copiados nem convertidos. As colunas mantêm a ordem do arquivo.
+     */
+    VectorStr usecols;
+
+    /**
+     * @brief Posições (0-based) das colunas a serem lidas, somadas a usecols
+     */
+    std::vector<size_t> usecolIndices;
+
+    /**
+     * @brief Número máximo de linhas de dados lidas (0 = todas)
+     *
+     * A leitura termina na última linha pedida; o restante do arquivo não é
+     * processado. Sem memoryMap, o arquivo é mapeado em memória e apenas as
+     * páginas até a última linha são lidas do disco (o texto é copiado, e o
+     * mapeamento é liberado ao fim da leitura).
+     */
+    size_t nrows = 0;
+
+    /**
+     * @brief Número de linhas ignoradas no início do arquivo, antes do cabeçalho
+     */
+    size_t skiprows = 0;
+};
+
+/**
+ * @brief Opções de escrita de arquivos CSV
+ *
+ * Campos de texto que contêm o delimitador, aspas ou quebras de linha são
+ * escritos entre aspas, com as aspas internas em dobro (RFC 4180), de modo
+ * que o arquivo é lido de volta sem alterações.
+ */
+struct WriteOptions {
+    char delimiter = ',';    ///< Caractere delimitador dos campos
+    bool header = true;      ///< Escrever a linha de cabeçalho (se houver nomes de colunas)
+
+    /**
+     * @brief Número de threads usadas na formatação (0 = pool compartilhado, ThreadPool::global())
+     *
+     * Com mais de uma thread, blocos de linhas são formatados em paralelo e
+     * a thread que chama grava cada bloco no arquivo, na ordem, assim que
+     * ele fica pronto. Tabelas pequenas são sempre escritas por uma única thread.
+     */
+    size_t numThreads = 1;
+
+    /**
+     * @brief Número de linhas formatadas por bloco antes de cada gravação
+     *
+     * Limita a memória usada pela escrita: no máximo alguns blocos
+     * formatados existem ao mesmo tempo, independentemente do tamanho da tabela.
+     */
+    size_t blockRows = 64 * 1024;
+};
+
+
+class RowView;
 
 /**
  * @class CSV
@@ -51,11 +165,54 @@ public:
      * @param delimiter Caractere delimitador dos campos
      */
     CSV(const std::string& filename, bool hasHeader = true, char delimiter = ',');
+
+    /**
+     * @brief Construtor com arquivo e opções de leitura
+     * @param filename Nome do arquivo CSV a ser lido
+     * @param options Opções de leitura
+     */
+    CSV(const std::string& filename, const ReadOptions& options);
     
     /**
      * @brief Destrutor
      */
     ~CSV();
+
+    CSV(const CSV&) = default;
+    CSV(CSV&&) noexcept = default;
+    CSV& operator=(const CSV&) = default;
+    CSV& operator=(CSV&&) noexcept = default;
+
+    class ChunkReader;
+
+    /**
+     * @brief Cria um CSV em memória a partir de colunas já tipadas
+     * @param headers Nomes das colunas
+     * @param columns Colunas, uma por nome e todas com o mesmo tamanho
+     * @return CSV com as colunas fornecidas
+     * @throws std::invalid_argument se os tamanhos forem inconsistentes
+     */
+    static CSV fromColumns(VectorStr headers, std::vector<ColumnBuffer> columns);
+
+    /**
+     * @brief Cria um CSV em memória a partir de linhas de texto, inferindo o tipo de cada coluna
+     *
+     * Linhas irregulares seguem as regras da leitura de arquivos: campos
+     * excedentes são descartados e campos ausentes são tratados como nulos.
+     *
+     * @param headers Nomes das colunas
+     * @param rows Linhas de dados
+     * @return CSV com colunas tipadas
+     */
+    static CSV fromRows(VectorStr headers, const DataFrame& rows);
+
+    /**
+     * @brief Cria um CSV com um subconjunto das linhas, mantendo os tipos das colunas
+     * @param rowIndices Índices das linhas, na ordem desejada
+     * @return Novo CSV com as linhas selecionadas
+     * @throws std::out_of_range se algum índice for inválido
+     */
+    CSV take(std::span<const size_t> rowIndices) const;
     
     /**
      * @brief Carrega um arquivo CSV
@@ -65,6 +222,15 @@ public:
      * @return true se o arquivo foi carregado com sucesso, false caso contrário
      */
     bool load(const std::string& filename, bool hasHeader = true, char delimiter = ',');
+
+    /**
+     * @brief Carrega um arquivo CSV com opções de leitura
+     * @param filename Nome do arquivo CSV a ser lido
+     * @param options Opções de leitura
+     * @return true se o arquivo foi carregado com sucesso, false caso contrário
+     * @throws std::invalid_argument se usecols referenciar uma coluna inexistente
+     */
+    bool load(const std::string& filename, const ReadOptions& options);
     
     /**
      * @brief Obtém o número de linhas
@@ -86,6 +252,9 @@ public:
     
     /**
      * @brief Obtém uma linha específica
+     *
+     * Copia todos os valores da linha; para apenas ler, prefira rowView().
+     *
      * @param rowIndex Índice da linha desejada (0-based)
      * @return Linha como um vetor de strings
      */
@@ -93,6 +262,9 @@ public:
     
     /**
      * @brief Obtém uma coluna pelo nome
+     *
+     * Copia todos os valores da coluna; para apenas ler, prefira columnView().
+     *
      * @param columnName Nome da coluna
      * @return Coluna como um vetor de strings
      */
@@ -104,9 +276,86 @@ public:
      * @return Coluna como um vetor de strings
      */
     Column getColumn(size_t columnIndex) const;
+
+    /**
+     * @brief Obtém uma visão de uma linha, sem copiar valores
+     * @param rowIndex Índice da linha desejada (0-based)
+     * @return Visão da linha, válida enquanto o CSV existir
+     * @throws std::out_of_range se o índice for inválido
+     */
+    RowView rowView(size_t rowIndex) const;
+
+    /**
+     * @brief Obtém uma visão de uma coluna pelo índice, sem copiar valores
+     * @param columnIndex Índice da coluna (0-based)
+     * @return Visão da coluna, válida enquanto o CSV existir
+     */
+    ColumnView columnView(size_t columnIndex) const { return ColumnView(column(columnIndex)); }
+
+    /**
+     * @brief Obtém uma visão de uma coluna pelo nome, sem copiar valores
+     * @param columnName Nome da coluna
+     * @return Visão da coluna, válida enquanto o CSV existir
+     */
+    ColumnView columnView(const std::string& columnName) const { return ColumnView(column(columnName)); }
     
     /**
-     * @brief Obtém todos os dados
+     * @brief Obtém uma coluna tipada pelo índice
+     * @param columnIndex Índice da coluna (0-based)
+     * @return Referência para o armazenamento tipado da coluna
+     */
+    const ColumnBuffer& column(size_t columnIndex) const;
+
+    /**
+     * @brief Obtém uma coluna tipada pelo nome
+     * @param columnName Nome da coluna
+     * @return Referência para o armazenamento tipado da coluna
+     */
+    const ColumnBuffer& column(const std::string& columnName) const;
+
+    /**
+     * @brief Substitui uma coluna, atualizando o tipo no esquema
+     * @param columnIndex Índice da coluna (0-based)
+     * @param column Nova coluna, com o mesmo número de linhas
+     * @throws std::out_of_range se o índice for inválido
+     * @throws std::invalid_argument se o tamanho da coluna for diferente
+     */
+    void setColumn(size_t columnIndex, ColumnBuffer column);
+
+    /**
+     * @brief Modifica em lugar os valores de uma coluna float64 (ver ColumnBuffer::updateFloat64())
+     * @param columnIndex Índice da coluna (0-based)
+     * @param func Função que recebe um std::span<double> com os valores
+     * @throws std::out_of_range se o índice for inválido
+     * @throws std::logic_error se a coluna não for float64
+     */
+    template <typename Func>
+    void updateFloat64(size_t columnIndex, Func&& func) {
+        m_columns.at(columnIndex).updateFloat64(std::forward<Func>(func));
+        m_rowCache = std::make_shared<RowCache>();
+    }
+
+    /**
+     * @brief Obtém o índice de uma coluna pelo nome
+     * @param columnName Nome da coluna
+     * @return Índice da coluna (0-based)
+     */
+    size_t columnIndex(const std::string& columnName) const;
+
+    /**
+     * @brief Verifica se existe uma coluna com o nome dado
+     * @param columnName Nome da coluna
+     * @return true se a coluna existir
+     */
+    bool hasColumn(const std::string& columnName) const;
+
+    /**
+     * @brief Obtém todos os dados como matriz de strings
+     *
+     * Caminho de compatibilidade: a matriz é materializada a partir das
+     * colunas tipadas na primeira chamada e mantida em cache. Chamadas
+     * concorrentes são seguras; a primeira monta a matriz e as demais esperam.
+     *
      * @return Matriz com todos os dados
      */
     const DataFrame& data() const;
@@ -119,24 +368,357 @@ public:
      */
     bool save(const std::string& filename, char delimiter = ',') const;
 
+    /**
+     * @brief Salva os dados em um novo arquivo CSV, em fluxo
+     *
+     * As linhas são formatadas em blocos de tamanho fixo, gravados assim que
+     * ficam prontos: a memória usada não depende do tamanho da tabela.
+     * Números são formatados com std::to_chars (float64 na representação
+     * mais curta que preserva o valor, com ".0" nos valores inteiros, para
+     * que a coluna seja relida como float64) e datas sem alocação; nulos
+     * são campos vazios.
+     *
+     * @param filename Nome do arquivo para salvar
+     * @param options Delimitador, cabeçalho, threads e tamanho dos blocos
+     * @return true se o arquivo foi salvo com sucesso, false caso contrário
+     */
+    bool save(const std::string& filename, const WriteOptions& options) const;
+
+    /**
+     * @brief Salva as colunas tipadas em um arquivo binário colunar
+     *
+     * Formato (ordem de bytes nativa, inteiros de 64 bits):
+     * - cabeçalho de 64 bytes com a assinatura "CPDBIN01", a versão e uma
+     *   marca de ordem de bytes;
+     * - por coluna, blocos alinhados em 64 bytes: os valores (float64,
+     *   int64 ou datetime com 8 bytes, bool com 1 byte por valor), o mapa de
+     *   validade (omitido se não houver nulos) e, para texto, os deslocamentos
+     *   (linhas + 1 inteiros) seguidos do conteúdo concatenado; categorias
+     *   gravam os códigos (1, 2 ou 4 bytes por valor) e o dicionário (número
+     *   de categorias, deslocamentos e texto);
+     * - rodapé com o número de linhas e o esquema (nome, tipo, nulos e
+     *   posição dos blocos de cada coluna), seguido da posição do rodapé e
+     *   da assinatura.
+     *
+     * @param filename Nome do arquivo
+     * @return true se o arquivo foi salvo com sucesso, false caso contrário
+     */
+    bool saveBinary(const std::string& filename) const;
+
+    /**
+     * @brief Abre um arquivo salvo por saveBinary() mapeando-o em memória
+     *
+     * Não há conversão de texto: as colunas de tamanho fixo referenciam o
+     * mapeamento diretamente e só são lidas do disco quando acessadas. Apenas
+     * os mapas de validade são copiados e as colunas de texto montam o índice
+     * de campos a partir dos deslocamentos gravados.
+     *
+     * @param filename Nome do arquivo
+     * @return true se o arquivo foi carregado, false se não puder ser aberto ou for inválido
+     */
+    bool loadBinary(const std::string& filename);
+
     char getDelimiter() const {
         return this->m_delimiter;
     }
 
+    /**
+     * @brief Obtém o esquema (nome e tipo de cada coluna) definido na leitura
+     * @return Esquema das colunas
+     */
+    const Schema& schema() const { return m_schema; }
+
 private:
-    DataFrame m_data;                      ///< Dados do arquivo CSV
+    // Matriz de data(), montada uma única vez mesmo com chamadas concorrentes.
+    // Alterações trocam o cache por um novo em vez de limpá-lo
+    struct RowCache {
+        std::once_flag buildOnce; ///< Montagem feita uma única vez
+        DataFrame rows;           ///< Valores formatados, linha a linha
+    };
+
+    std::vector<ColumnBuffer> m_columns;   ///< Dados do arquivo CSV, armazenados por coluna
+    size_t m_rowCount;                     ///< Número de linhas de dados
+    std::shared_ptr<RowCache> m_rowCache = std::make_shared<RowCache>(); ///< Matriz de strings materializada sob demanda (compartilhada entre cópias)
     VectorStr m_headers;    ///< Nomes das colunas
     std::unordered_map<std::string, size_t> m_headerMap; ///< Mapeamento de nomes para índices
     bool m_hasHeader;                      ///< Se o arquivo tem cabeçalho
     char m_delimiter;                      ///< Delimitador usado no arquivo
+    Schema m_schema;                       ///< Tipos das colunas, definidos uma única vez na leitura
     
     /**
-     * @brief Processa uma linha do CSV
-     * @param line Linha a ser processada
-     * @param delimiter Caractere delimitador
-     * @return Vetor com os campos da linha
+     * @brief Define os nomes das colunas e o mapeamento de nomes para índices
+     * @param headers Nomes das colunas
+     */
+    void setHeaders(VectorStr headers);
+
+    /**
+     * @brief Processa o conteúdo completo de um arquivo CSV
+     * @param begin Início do conteúdo
+     * @param end Fim do conteúdo
+     * @param owner Dono da memória, mantido pelas colunas de texto (opcional)
+     * @param options Opções de leitura
+     */
+    void parseBuffer(const char* begin, const char* end, std::shared_ptr<const void> owner,
+                     const ReadOptions& options);
+
+    /**
+     * @brief Processa as linhas de dados (sem cabeçalho) e monta as colunas tipadas
+     * @param begin Início dos dados (início de uma linha)
+     * @param end Fim dos dados
+     * @param owner Dono da memória, mantido pelas colunas de texto (opcional)
+     * @param options Opções de leitura
+     * @param sourceColumns Posição no arquivo de cada coluna lida, em ordem crescente
+     */
+    void parseData(const char* begin, const char* end, std::shared_ptr<const void> owner,
+                   const ReadOptions& options, const std::vector<size_t>& sourceColumns);
+
+    /**
+     * @brief Obtém o nome de cada coluna lida no esquema
+     * @param sourceColumns Posição no arquivo de cada coluna lida
+     * @return Nomes do cabeçalho ou, sem ele, as posições no arquivo ("0", "1", ...)
+     */
+    VectorStr columnNames(const std::vector<size_t>& sourceColumns) const;
+
+    /**
+     * @brief Converte os campos já separados por coluna e registra os tipos no esquema
+     * @param cells Campos de cada coluna (consumidos)
+     * @param owner Dono da memória dos campos (opcional)
+     * @param options Opções de leitura (esquema e amostragem)
+     * @param names Nome de cada coluna no esquema
+     * @param minimumTypes Tipo mínimo de cada coluna, vindo de lotes anteriores (opcional)
+     */
+    void setColumns(std::vector<std::vector<std::string_view>>& cells, const std::shared_ptr<const void>& owner,
+                    const ReadOptions& options, const VectorStr& names, const Schema* minimumTypes);
+
+    /**
+     * @brief Converte os campos de uma coluna para o tipo explícito ou inferido
+     * @param name Nome da coluna no esquema
+     * @param cells Campos da coluna
+     * @param owner Dono da memória dos campos (opcional)
+     * @param options Opções de leitura (esquema e amostragem)
+     * @param minimumTypes Tipo mínimo de cada coluna, vindo de lotes anteriores (opcional)
+     * @return Coluna tipada
+     */
+    ColumnBuffer makeColumn(const std::string& name, std::vector<std::string_view> cells,
+                            const std::shared_ptr<const void>& owner, const ReadOptions& options,
+                            const Schema* minimumTypes) const;
+
+    /**
+     * @brief Registra no esquema o tipo final de cada coluna
+     * @param names Nome de cada coluna no esquema
+     */
+    void updateSchema(const VectorStr& names);
+
+    /**
+     * @brief Processa um bloco de linhas completas, distribuindo os campos por coluna
+     * @param begin Início do bloco (início de uma linha)
+     * @param end Fim do bloco (fim de uma linha)
+     * @param cells Colunas que recebem os campos; o tamanho define o número de colunas
+     * @param fieldSlots Coluna de destino de cada campo da linha (campos sem destino são descartados)
+     * @param unescaped Arena que recebe os campos entre aspas que precisaram de unescape
+     * @param maxRows Número máximo de linhas (0 = todas); a varredura para na última
+     * @return Número de linhas processadas
+     */
+    size_t parseRows(const char* begin, const char* end, std::vector<std::vector<std::string_view>>& cells,
+                     const std::vector<size_t>& fieldSlots, detail::StringArena& unescaped,
+                     size_t maxRows = 0) const;
+};
+
+/**
+ * @class RowView
+ * @brief Visão não proprietária de uma linha de um CSV
+ *
+ * Referencia as colunas do CSV em vez de copiar os valores; cada valor é
+ * lido ou formatado apenas quando acessado. Opcionalmente restrita a uma
+ * lista de posições de colunas (as colunas ativas de um DataFrame), na
+ * ordem da lista. A visão é válida enquanto o CSV e a lista existirem.
+ */
+class RowView {
+public:
+    using iterator = ViewIterator<RowView>;
+
+    /**
+     * @brief Cria uma visão de uma linha
+     * @param csv CSV de origem
+     * @param rowIndex Índice da linha (0-based)
+     * @param columns Posições das colunas visíveis no CSV (nullptr = todas, na ordem do arquivo)
+     */
+    RowView(const CSV& csv, size_t rowIndex, const std::vector<size_t>* columns = nullptr)
+        : m_csv(&csv), m_row(rowIndex), m_columns(columns) {}
+
+    /**
+     * @brief Obtém o número de valores da linha
+     * @return Número de colunas visíveis
+     */
+    size_t size() const { return m_columns ? m_columns->size() : m_csv->columnCount(); }
+
+    /**
+     * @brief Verifica se a linha não tem colunas
+     * @return true se não houver colunas visíveis
+     */
+    bool empty() const { return size() == 0; }
+
+    /**
+     * @brief Obtém o índice da linha no CSV
+     * @return Índice da linha (0-based)
+     */
+    size_t index() const { return m_row; }
+
+    /**
+     * @brief Obtém a coluna tipada de uma posição da linha
+     * @param position Posição na linha (0-based)
+     * @return Referência para a coluna
+     */
+    const ColumnBuffer& column(size_t position) const {
+        return m_columns ? m_csv->column((*m_columns)[position]) : m_csv->column(position);
+    }
+
+    /**
+     * @brief Obtém a representação textual de um valor, sem verificar a posição
+     * @param position Posição na linha (0-based)
+     * @return Valor formatado (string vazia para nulos)
+     */
+    std::string operator[](size_t position) const { return column(position).getString(m_row); }
+
+    /**
+     * @brief Obtém a representação textual de um valor
+     * @param position Posição na linha (0-based)
+     * @return Valor formatado (string vazia para nulos)
+     * @throws std::out_of_range se a posição for inválida
+     */
+    std::string at(size_t position) const {
+        if (position >= size()) {
+            throw std::out_of_range("Column index out of range");
+        }
+        return (*this)[position];
+    }
+
+    /**
+     * @brief Verifica se um valor é nulo
+     * @param position Posição na linha (0-based)
+     * @return true se o valor for nulo
+     */
+    bool isNull(size_t position) const { return column(position).isNull(m_row); }
+
+    /**
+     * @brief Obtém um valor como double
+     * @param position Posição na linha (0-based)
+     * @return Valor numérico ou NaN se nulo ou não numérico
+     */
+    double getDouble(size_t position) const { return column(position).getDouble(m_row); }
+
+    /**
+     * @brief Copia os valores como texto
+     * @return Linha como um vetor de strings
+     */
+    CSV::Row toVector() const {
+        CSV::Row row;
+        row.reserve(size());
+        for (size_t i = 0; i < size(); ++i) {
+            row.push_back((*this)[i]);
+        }
+        return row;
+    }
+
+    iterator begin() const { return iterator(this, 0); }
+    iterator end() const { return iterator(this, size()); }
+
+private:
+    const CSV* m_csv;                 ///< CSV de origem
+    size_t m_row;                     ///< Índice da linha
+    const std::vector<size_t>* m_columns; ///< Posições das colunas visíveis (nullptr = todas)
+};
+
+/**
+ * @class CSV::ChunkReader
+ * @brief Leitura incremental de arquivos CSV em lotes de linhas
+ *
+ * O arquivo é lido em blocos de tamanho fixo e cada chamada a next()
+ * produz um CSV com até chunkSize linhas, de modo que a memória usada é
+ * limitada pelo tamanho do lote e não pelo tamanho do arquivo. O buffer
+ * de leitura é reaproveitado entre os lotes.
+ *
+ * Os tipos das colunas só são ampliados de um lote para o seguinte (ver
+ * schema()), e nenhum valor é descartado, de modo que agregações sobre o
+ * arquivo inteiro podem combinar os lotes.
+ */
+class CSV::ChunkReader {
+public:
+    /**
+     * @brief Abre o arquivo e lê o cabeçalho
+     * @param filename Nome do arquivo CSV a ser lido
+     * @param chunkSize Número máximo de linhas por lote
+     * @param options Opções de leitura (memoryMap é ignorado; nrows limita o total de linhas)
+     * @throws std::invalid_argument se chunkSize for zero ou usecols for inválido
+     */
+    ChunkReader(const std::string& filename, size_t chunkSize, const ReadOptions& options = ReadOptions());
+
+    /**
+     * @brief Verifica se o arquivo foi aberto com sucesso
+     * @return true se o arquivo está aberto
+     */
+    bool isOpen() const { return m_file.is_open(); }
+
+    /**
+     * @brief Obtém os nomes das colunas
+     * @return Vetor com os nomes das colunas
+     */
+    const VectorStr& headers() const { return m_headers; }
+
+    /**
+     * @brief Lê o próximo lote de linhas
+     * @param batch CSV que recebe o lote (seu conteúdo anterior é substituído)
+     * @return true se algum dado foi lido, false ao fim do arquivo
+     */
+    bool next(CSV& batch);
+
+    /**
+     * @brief Obtém o número total de linhas de dados já lidas
+     * @return Número de linhas
      */
-    Row parseLine(const std::string& line, char delimiter) const;
+    size_t rowsRead() const { return m_rowsRead; }
+
+    /**
+     * @brief Obtém os tipos das colunas até o último lote lido
+     *
+     * Cada lote é inferido como em read_csv e combinado com os tipos dos
+     * lotes anteriores (ColumnBuffer::commonDType()). Se um valor não couber
+     * no tipo atual, a coluna é ampliada (int64 -> float64 -> string,
+     * bool/datetime -> string) a partir desse lote e o novo tipo aparece
+     * aqui; lotes já entregues mantêm o tipo que tinham. Assim, int64 só é
+     * promovido para float64 quando um lote tem nulos, como em read_csv.
+     *
+     * @return Esquema (antes da primeira chamada a next(), apenas ReadOptions::schema)
+     */
+    const Schema& schema() const { return m_schema; }
+
+private:
+    /**
+     * @brief Descarta os dados já consumidos e lê o próximo bloco do arquivo
+     * @return false se o fim do arquivo já foi alcançado
+     */
+    bool fill();
+
+    /**
+     * @brief Lê a próxima linha completa, lendo mais blocos se necessário
+     * @param fields Recebe os campos da linha
+     * @param consume Se a linha deve ser consumida ou apenas examinada
+     */
+    void readRecord(VectorStr& fields, bool consume);
+
+    std::ifstream m_file;          ///< Arquivo de entrada
+    ReadOptions m_options;         ///< Opções de leitura
+    size_t m_chunkSize;            ///< Número máximo de linhas por lote
+    VectorStr m_headers;           ///< Nomes das colunas selecionadas
+    std::vector<size_t> m_sourceColumns; ///< Posição no arquivo das colunas selecionadas
+    std::vector<size_t> m_fieldSlots;    ///< Coluna de destino de cada campo da linha
+    std::vector<char> m_buffer;    ///< Buffer de leitura, reaproveitado entre lotes
+    std::vector<uint32_t> m_positions; ///< Posições emitidas pelo tokenizador, reaproveitadas entre lotes
+    size_t m_begin = 0;            ///< Início dos dados ainda não consumidos
+    size_t m_end = 0;              ///< Fim dos dados válidos no buffer
+    bool m_eof = false;            ///< Se o arquivo inteiro já está no buffer
+    size_t m_rowsRead = 0;         ///< Linhas de dados já entregues
+    Schema m_schema;               ///< Tipos das colunas até o último lote lido
 };
 
 } // namespace CPPandas
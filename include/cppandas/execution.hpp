@@ -0,0 +1,136 @@
+/**
+ * @file execution.hpp
+ * @brief Política de execução (sequencial ou paralela) das operações do DataFrame
+ * @author CPPandas Team
+ */
+
+#ifndef CPPANDAS_EXECUTION_HPP
+#define CPPANDAS_EXECUTION_HPP
+
+#include "cppandas/thread_pool.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace CPPandas {
+
+/**
+ * @brief Modo de execução de uma operação
+ */
+enum class Execution {
+    Sequential,  ///< Sempre na thread que chama
+    Parallel,    ///< Sempre no pool de threads
+    Auto         ///< No pool apenas se o volume de dados justificar
+};
+
+/**
+ * @brief Política de execução passada às operações do DataFrame
+ *
+ * As operações dividem o trabalho por coluna (describe, quantile, mode,
+ * StandardScaler, hist) ou em blocos de linhas (dropna) e executam as
+ * partes no pool indicado, ou no pool compartilhado ThreadPool::global().
+ *
+ * Exemplo:
+ * @code
+ * auto summary = df.describe({0.25, 0.5, 0.75}, ExecutionPolicy::parallel());
+ * auto scaled = StandardScaler().fit_transform(df, ExecutionPolicy::sequential());
+ * @endcode
+ */
+struct ExecutionPolicy {
+    Execution mode = Execution::Auto;   ///< Modo de execução
+    std::shared_ptr<ThreadPool> pool;   ///< Pool usado (nullptr = ThreadPool::global())
+
+    /**
+     * @brief Volume mínimo (em células) para o modo Auto usar o pool
+     */
+    size_t minParallelCells = size_t(1) << 18;
+
+    /**
+     * @brief Número mínimo de linhas por bloco nas operações divididas por linhas
+     */
+    size_t minRowsPerChunk = size_t(1) << 14;
+
+    /**
+     * @brief Cria uma política sequencial
+     * @return Política que executa tudo na thread que chama
+     */
+    static ExecutionPolicy sequential() {
+        ExecutionPolicy policy;
+        policy.mode = Execution::Sequential;
+        return policy;
+    }
+
+    /**
+     * @brief Cria uma política paralela
+     * @param pool Pool a ser usado (nullptr = ThreadPool::global())
+     * @return Política que executa as partes no pool
+     */
+    static ExecutionPolicy parallel(std::shared_ptr<ThreadPool> pool = nullptr) {
+        ExecutionPolicy policy;
+        policy.mode = Execution::Parallel;
+        policy.pool = std::move(pool);
+        return policy;
+    }
+
+    /**
+     * @brief Decide se uma operação deve usar o pool
+     * @param tasks Número de partes independentes
+     * @param cells Volume total de dados da operação
+     * @return true se houver mais de uma parte e o modo permitir
+     */
+    bool runsParallel(size_t tasks, size_t cells) const {
+        if (tasks < 2 || mode == Execution::Sequential) {
+            return false;
+        }
+        return mode == Execution::Parallel || cells >= minParallelCells;
+    }
+
+    /**
+     * @brief Executa body(i) para cada i em [0, tasks), no pool ou em sequência
+     * @param tasks Número de partes independentes
+     * @param cells Volume total de dados, usado pelo modo Auto
+     * @param body Função chamada com o índice da parte
+     */
+    void forEach(size_t tasks, size_t cells, const std::function<void(size_t)>& body) const {
+        if (!runsParallel(tasks, cells)) {
+            for (size_t i = 0; i < tasks; ++i) {
+                body(i);
+            }
+            return;
+        }
+        std::shared_ptr<ThreadPool> threads = pool ? pool : ThreadPool::global();
+        threads->parallelFor(tasks, body);
+    }
+
+    /**
+     * @brief Divide [0, rows) em blocos e executa body(begin, end) para cada um
+     *
+     * Os blocos têm ao menos minRowsPerChunk linhas (exceto o último) e
+     * começam em múltiplos de 64, de modo que blocos diferentes nunca
+     * compartilham uma palavra de um Bitmap.
+     *
+     * @param rows Número de linhas
+     * @param columns Número de colunas processadas por linha (para o modo Auto)
+     * @param body Função chamada com o intervalo de linhas de cada bloco
+     */
+    void forEachChunk(size_t rows, size_t columns,
+                      const std::function<void(size_t, size_t)>& body) const {
+        size_t chunks = 1;
+        if (runsParallel(rows / std::max<size_t>(minRowsPerChunk, 1), rows * columns)) {
+            size_t threads = pool ? pool->size() : ThreadPool::global()->size();
+            chunks = std::min(threads * 4, rows / std::max<size_t>(minRowsPerChunk, 1));
+        }
+        size_t chunkRows = (rows / std::max<size_t>(chunks, 1) + 63) / 64 * 64;
+        chunks = chunkRows == 0 ? 1 : (rows + chunkRows - 1) / chunkRows;
+
+        forEach(chunks, rows * columns, [&](size_t chunk) {
+            size_t begin = chunk * chunkRows;
+            body(begin, std::min(begin + chunkRows, rows));
+        });
+    }
+};
+
+} // namespace CPPandas
+
+#endif // CPPANDAS_EXECUTION_HPP
@@ -0,0 +1,207 @@
+/**
+ * @file frequency.hpp
+ * @brief Contagem de valores distintos com tabela hash de endereçamento aberto
+ * @author CPPandas Team
+ */
+
+#ifndef CPPANDAS_FREQUENCY_HPP
+#define CPPANDAS_FREQUENCY_HPP
+
+#include "cppandas/column.hpp"
+#include "cppandas/execution.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace CPPandas {
+
+/**
+ * @brief Função hash usada por FrequencyTable
+ *
+ * Inteiros e doubles passam por uma mistura de bits (splitmix64), pois a
+ * tabela usa máscaras de potência de 2 e IDs sequenciais teriam colisões
+ * em cadeia. -0.0 e 0.0 têm o mesmo hash, já que são iguais.
+ */
+template <typename Key>
+struct FrequencyHash {
+    size_t operator()(Key key) const { return std::hash<Key>()(key); }
+};
+
+namespace detail {
+
+inline uint64_t mixBits(uint64_t bits) {
+    bits ^= bits >> 30;
+    bits *= 0xbf58476d1ce4e5b9ULL;
+    bits ^= bits >> 27;
+    bits *= 0x94d049bb133111ebULL;
+    bits ^= bits >> 31;
+    return bits;
+}
+
+} // namespace detail
+
+template <>
+struct FrequencyHash<int64_t> {
+    size_t operator()(int64_t key) const { return detail::mixBits(static_cast<uint64_t>(key)); }
+};
+
+template <>
+struct FrequencyHash<double> {
+    size_t operator()(double key) const {
+        return detail::mixBits(std::bit_cast<uint64_t>(key == 0.0 ? 0.0 : key));
+    }
+};
+
+/**
+ * @class FrequencyTable
+ * @brief Tabela hash de contagens com endereçamento aberto e memória contígua
+ *
+ * As entradas (chave, contagem e primeira linha em que a chave aparece)
+ * ficam em um vetor denso, na ordem de inserção; a tabela de slots guarda
+ * apenas índices nesse vetor e é sondada linearmente, com ocupação máxima
+ * de 50%. Não há alocação por valor, ao contrário de std::map ou
+ * std::unordered_map.
+ *
+ * Tabelas montadas em blocos de linhas diferentes (uma por thread) são
+ * combinadas com merge().
+ *
+ * @tparam Key Tipo da chave (double, int64_t ou std::string_view)
+ */
+template <typename Key, typename Hash = FrequencyHash<Key>>
+class FrequencyTable {
+public:
+    /**
+     * @brief Valor distinto e sua contagem
+     */
+    struct Entry {
+        Key key;          ///< Valor
+        size_t count;     ///< Número de ocorrências
+        size_t firstRow;  ///< Primeira linha em que o valor aparece
+    };
+
+    /**
+     * @brief Cria uma tabela vazia
+     * @param expected Número esperado de valores distintos (para reservar espaço)
+     */
+    explicit FrequencyTable(size_t expected = 0) {
+        size_t capacity = 16;
+        while (capacity < expected * 2) {
+            capacity *= 2;
+        }
+        m_slots.assign(capacity, kEmpty);
+        m_entries.reserve(expected);
+    }
+
+    /**
+     * @brief Conta uma ocorrência de um valor
+     * @param key Valor
+     * @param row Linha da ocorrência
+     * @return Índice da entrada do valor em entries()
+     */
+    size_t add(const Key& key, size_t row) { return add(key, 1, row); }
+
+    /**
+     * @brief Conta várias ocorrências de um valor
+     * @param key Valor
+     * @param count Número de ocorrências
+     * @param row Primeira linha das ocorrências
+     * @return Índice da entrada do valor em entries()
+     */
+    size_t add(const Key& key, size_t count, size_t row) {
+        size_t slot = findSlot(key);
+        if (m_slots[slot] != kEmpty) {
+            Entry& entry = m_entries[m_slots[slot]];
+            entry.count += count;
+            entry.firstRow = std::min(entry.firstRow, row);
+            return m_slots[slot];
+        }
+        size_t index = m_entries.size();
+        m_slots[slot] = index;
+        m_entries.push_back({key, count, row});
+        if (m_entries.size() * 2 > m_slots.size()) {
+            grow();
+        }
+        return index;
+    }
+
+    /**
+     * @brief Soma as contagens de outra tabela a esta
+     * @param other Tabela de outro bloco de linhas
+     */
+    void merge(const FrequencyTable& other) {
+        for (const Entry& entry : other.m_entries) {
+            add(entry.key, entry.count, entry.firstRow);
+        }
+    }
+
+    /**
+     * @brief Obtém o número de valores distintos
+     * @return Número de entradas
+     */
+    size_t size() const { return m_entries.size(); }
+
+    /**
+     * @brief Obtém as entradas, na ordem em que os valores foram inseridos
+     * @return Entradas da tabela
+     */
+    std::span<const Entry> entries() const { return m_entries; }
+
+private:
+    static constexpr size_t kEmpty = SIZE_MAX;
+
+    size_t findSlot(const Key& key) const {
+        size_t mask = m_slots.size() - 1;
+        size_t slot = Hash()(key) & mask;
+        while (m_slots[slot] != kEmpty && !(m_entries[m_slots[slot]].key == key)) {
+            slot = (slot + 1) & mask;
+        }
+        return slot;
+    }
+
+    void grow() {
+        m_slots.assign(m_slots.size() * 2, kEmpty);
+        size_t mask = m_slots.size() - 1;
+        for (size_t i = 0; i < m_entries.size(); ++i) {
+            size_t slot = Hash()(m_entries[i].key) & mask;
+            while (m_slots[slot] != kEmpty) {
+                slot = (slot + 1) & mask;
+            }
+            m_slots[slot] = i;
+        }
+    }
+
+    std::vector<size_t> m_slots;    ///< Índice da entrada de cada slot (kEmpty = livre)
+    std::vector<Entry> m_entries;   ///< Entradas, na ordem de inserção
+};
+
+/**
+ * @brief Contagem de um valor distinto de uma coluna
+ */
+struct ValueFrequency {
+    size_t firstRow;  ///< Primeira linha em que o valor aparece
+    size_t count;     ///< Número de ocorrências
+};
+
+/**
+ * @brief Conta os valores distintos não nulos de uma coluna
+ *
+ * Colunas float64 são contadas por valor double, int64, bool e datetime
+ * pelo inteiro armazenado e colunas de texto pelo conteúdo, sem cópias.
+ * Com uma política paralela, cada bloco de linhas tem sua própria tabela e
+ * as tabelas são combinadas ao final, na ordem das linhas.
+ *
+ * @param column Coluna
+ * @param policy Execução sequencial ou paralela (blocos de linhas)
+ * @return Um item por valor distinto, na ordem da primeira ocorrência
+ */
+std::vector<ValueFrequency> countValues(const ColumnBuffer& column,
+                                        const ExecutionPolicy& policy = ExecutionPolicy());
+
+} // namespace CPPandas
+
+#endif // CPPANDAS_FREQUENCY_HPP
@@ -0,0 +1,65 @@
+/**
+ * @file mapped_file.hpp
+ * @brief Mapeamento de arquivos em memória (somente leitura)
+ * @author CPPandas Team
+ */
+
+#ifndef CPPANDAS_MAPPED_FILE_HPP
+#define CPPANDAS_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace CPPandas {
+
+/**
+ * @class MappedFile
+ * @brief Arquivo mapeado em memória, somente leitura
+ *
+ * O mapeamento permanece válido enquanto existir alguma referência ao
+ * objeto; colunas carregadas sem cópia mantêm um std::shared_ptr para ele.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Mapeia um arquivo em memória
+     * @param filename Nome do arquivo
+     * @return Arquivo mapeado, ou nullptr se não for possível abri-lo
+     */
+    static std::shared_ptr<const MappedFile> open(const std::string& filename);
+
+    /**
+     * @brief Destrutor, desfaz o mapeamento
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Obtém o início do conteúdo mapeado
+     * @return Ponteiro para o primeiro byte do arquivo
+     */
+    const char* data() const { return m_data; }
+
+    /**
+     * @brief Obtém o tamanho do arquivo
+     * @return Tamanho em bytes
+     */
+    size_t size() const { return m_size; }
+
+private:
+    MappedFile() = default;
+
+    const char* m_data = nullptr;  ///< Início do mapeamento
+    size_t m_size = 0;             ///< Tamanho do arquivo
+#ifdef _WIN32
+    void* m_file = nullptr;        ///< HANDLE do arquivo
+    void* m_mapping = nullptr;     ///< HANDLE do mapeamento
+#endif
+};
+
+} // namespace CPPandas
+
+#endif // CPPANDAS_MAPPED_FILE_HPP
@@ -0,0 +1,210 @@
+/**
+ * @file numeric.hpp
+ * @brief Conversão de texto para números e datas sem exceções, baseada em std::from_chars
+ * @author CPPandas Team
+ */
+
+#ifndef CPPANDAS_NUMERIC_HPP
+#define CPPANDAS_NUMERIC_HPP
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CPPandas {
+
+/**
+ * @brief Resultado de uma conversão de texto para número
+ */
+enum class ParseStatus {
+    Ok,          ///< Conversão bem-sucedida
+    Empty,       ///< Texto vazio ou apenas espaços (valor nulo)
+    Invalid,     ///< O texto não é um número completo
+    OutOfRange   ///< O número não cabe no tipo de destino
+};
+
+/**
+ * @brief Valor convertido e o status da conversão
+ */
+template <typename T>
+struct ParseResult {
+    T value{};                          ///< Valor convertido (válido apenas se ok())
+    ParseStatus status = ParseStatus::Empty;  ///< Status da conversão
+
+    /**
+     * @brief Verifica se a conversão foi bem-sucedida
+     * @return true se o status for ParseStatus::Ok
+     */
+    bool ok() const { return status == ParseStatus::Ok; }
+};
+
+/**
+ * @brief Verifica se um texto representa um valor ausente
+ *
+ * Segue os na_values padrão do pandas: texto vazio ou apenas espaços,
+ * "NA", "N/A", "n/a", "NaN", "nan", "-NaN", "-nan", "NULL", "null",
+ * "None", "<NA>", "#N/A", "#N/A N/A", "#NA", "1.#IND", "-1.#IND",
+ * "1.#QNAN" e "-1.#QNAN" (com espaços nas extremidades ignorados).
+ * Na leitura, esses valores são nulos em colunas de qualquer tipo, de
+ * modo que um único marcador não impede a coluna de ser numérica.
+ *
+ * @param text Texto a ser verificado
+ * @return true se o texto for um valor ausente
+ */
+inline bool isNullValue(std::string_view text);
+
+namespace detail {
+
+/**
+ * @brief Compara um texto não vazio com os marcadores de isNullValue()
+ * @param text Texto a ser verificado
+ * @return true se o texto for um valor ausente
+ */
+bool isNullMarker(std::string_view text);
+
+} // namespace detail
+
+// Chamada para cada campo lido: sem espaços nas extremidades, só textos
+// curtos que começam como um marcador chegam a ser comparados com a lista
+inline bool isNullValue(std::string_view text) {
+    if (text.empty()) {
+        return true;
+    }
+    const char first = text.front();
+    const char last = text.back();
+    if (first == ' ' || first == '\t' || first == '\r' || last == ' ' || last == '\t' || last == '\r') {
+        return detail::isNullMarker(text);
+    }
+    if (text.size() > 8) {
+        return false;
+    }
+    switch (first) {
+        case 'N': case 'n': case '<': case '#':
+            return detail::isNullMarker(text);
+        case '1':
+            return text.size() >= 6 && text[1] == '.' && detail::isNullMarker(text);
+        case '-':
+            return text.size() >= 4 && (text[1] == 'N' || text[1] == 'n' || text[1] == '1') &&
+                   detail::isNullMarker(text);
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Converte um texto para double
+ *
+ * Espaços nas extremidades e um sinal '+' inicial são aceitos; o restante
+ * do texto precisa formar um número completo ("1/3/1994" é inválido).
+ *
+ * @param text Texto a ser convertido
+ * @return Valor e status da conversão
+ */
+ParseResult<double> parseDouble(std::string_view text);
+
+/**
+ * @brief Converte um texto para inteiro de 64 bits
+ * @param text Texto a ser convertido (mesmas regras de parseDouble)
+ * @return Valor e status da conversão
+ */
+ParseResult<int64_t> parseInt64(std::string_view text);
+
+/**
+ * @brief Converte um texto booleano ("True"/"true"/"TRUE" ou "False"/"false"/"FALSE")
+ * @param text Texto a ser convertido
+ * @return Valor e status da conversão
+ */
+ParseResult<bool> parseBool(std::string_view text);
+
+/**
+ * @brief Converte um texto de data/hora para nanossegundos desde 1970-01-01
+ *
+ * Formatos aceitos, com hora opcional ("HH:MM", "HH:MM:SS" ou
+ * "HH:MM:SS.fff", separada por espaço ou 'T'):
+ * - ISO: "1994-01-03" ou "1994/01/03"
+ * - Mês/dia/ano: "1/3/1994" ou "01/03/1994"
+ *
+ * Textos apenas com hora ("11:00") são inválidos.
+ *
+ * @param text Texto a ser convertido
+ * @return Nanossegundos desde a época e status da conversão
+ */
+ParseResult<int64_t> parseDatetime(std::string_view text);
+
+/**
+ * @brief Formata nanossegundos desde 1970-01-01 como "AAAA-MM-DD[ HH:MM:SS[.fff]]"
+ *
+ * A hora é omitida quando é meia-noite exata.
+ *
+ * @param nanoseconds Instante a ser formatado
+ * @return Texto no formato ISO
+ */
+std::string formatDatetime(int64_t nanoseconds);
+
+/**
+ * @brief Tamanho máximo do texto gerado por formatDatetime()
+ */
+constexpr size_t kDatetimeTextSize = 40;
+
+/**
+ * @brief Formata nanossegundos desde 1970-01-01 diretamente em um buffer, sem alocação
+ * @param nanoseconds Instante a ser formatado
+ * @param out Destino, com espaço para kDatetimeTextSize caracteres
+ * @return Número de caracteres escritos
+ */
+size_t formatDatetime(int64_t nanoseconds, char* out);
+
+/**
+ * @brief Tamanho máximo do texto gerado por formatFloat64()
+ */
+constexpr size_t kFloat64TextSize = 32;
+
+/**
+ * @brief Formata um double na representação mais curta que preserva o valor
+ *
+ * Valores inteiros recebem ".0" (como no pandas), de modo que uma coluna
+ * float64 salva em CSV continua float64 ao ser lida de volta.
+ *
+ * @param value Valor a ser formatado
+ * @param out Destino, com espaço para kFloat64TextSize caracteres
+ * @return Número de caracteres escritos
+ */
+size_t formatFloat64(double value, char* out);
+
+/**
+ * @brief Coluna convertida para double com máscara de validade
+ */
+struct NumericBuffer {
+    std::vector<double> values;   ///< Valores convertidos (NaN onde inválido)
+    std::vector<uint8_t> valid;   ///< 1 onde o valor foi convertido, 0 caso contrário
+    size_t validCount = 0;        ///< Número de valores convertidos
+    size_t emptyCount = 0;        ///< Número de valores nulos (vazios ou marcadores de isNullValue())
+};
+
+/**
+ * @brief Converte uma coluna de texto para double em uma única passada
+ *
+ * Como na leitura de CSV, valores nulos (isNullValue()) e textos que
+ * representam NaN são inválidos.
+ *
+ * @param cells Valores textuais
+ * @return Valores, máscara de validade e contagens
+ */
+NumericBuffer toNumeric(std::span<const std::string_view> cells);
+
+/**
+ * @brief Converte uma coluna de texto para double em uma única passada
+ *
+ * Como na leitura de CSV, valores nulos (isNullValue()) e textos que
+ * representam NaN são inválidos.
+ *
+ * @param cells Valores textuais
+ * @return Valores, máscara de validade e contagens
+ */
+NumericBuffer toNumeric(std::span<const std::string> cells);
+
+} // namespace CPPandas
+
+#endif // CPPANDAS_NUMERIC_HPP
@@ -0,0 +1,181 @@
+/**
+ * @file quantile.hpp
+ * @brief Cálculo de quantis por seleção, sem ordenação completa, e quantis aproximados (t-digest)
+ * @author CPPandas Team
+ */
+
+#ifndef CPPANDAS_QUANTILE_HPP
+#define CPPANDAS_QUANTILE_HPP
+
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace CPPandas {
+
+/**
+ * @brief Calcula quantis por seleção, reordenando parcialmente os valores
+ *
+ * As posições necessárias (duas por quantil, para a interpolação linear)
+ * são extraídas por particionamento recursivo: a posição central é
+ * selecionada com std::nth_element e cada metade dos valores só é
+ * particionada de novo para as posições que caem nela. Um único quantil
+ * custa O(n) e k quantis custam O(n log k), em vez de O(n log n).
+ *
+ * A interpolação é a mesma do pandas (método "linear"): o quantil q fica
+ * na posição q * (n - 1) dos valores ordenados.
+ *
+ * @param values Valores válidos (sem NaN); reordenados pela seleção
+ * @param qs Quantis desejados (entre 0 e 1), em qualquer ordem
+ * @return Quantis na ordem pedida (NaN se não houver valores)
+ * @throws std::invalid_argument se algum quantil estiver fora de [0, 1]
+ */
+std::vector<double> selectQuantiles(std::span<double> values, std::span<const double> qs);
+
+/**
+ * @brief Calcula quantis de valores já ordenados, em tempo constante por quantil
+ * @param sorted Valores válidos em ordem crescente
+ * @param qs Quantis desejados (entre 0 e 1)
+ * @return Quantis na ordem pedida (NaN se não houver valores)
+ * @throws std::invalid_argument se algum quantil estiver fora de [0, 1]
+ */
+std::vector<double> sortedQuantiles(std::span<const double> sorted, std::span<const double> qs);
+
+/**
+ * @class TDigest
+ * @brief Resumo compacto e combinável de uma distribuição para quantis aproximados
+ *
+ * Implementa o t-digest com fusão (Dunning), com a função de escala k1: os
+ * valores são agrupados em centroides (média e peso), pequenos nas caudas e
+ * maiores no centro, de modo que o erro de posição é menor nos quantis
+ * extremos. O tamanho é limitado por compression() centroides,
+ * independentemente do número de valores, e dois resumos podem ser
+ * combinados com merge(), o que permite resumir blocos de linhas ou
+ * arquivos separadamente, inclusive em threads diferentes.
+ *
+ * Os quantis usam a mesma convenção de quantile() (posição q * (n - 1)) e
+ * são exatos enquanto todos os centroides tiverem peso 1.
+ *
+ * Exemplo:
+ * @code
+ * TDigest digest = TDigest::forAccuracy(0.01);
+ * for (const auto& chunk : chunks) {
+ *     TDigest part = chunk.sketch("pH", 0.01);
+ *     digest.merge(part);
+ * }
+ * double p99 = digest.quantile(0.99);
+ * @endcode
+ */
+class TDigest {
+public:
+    /**
+     * @brief Cria um resumo vazio
+     * @param compression Número aproximado máximo de centroides (mínimo 20)
+     */
+    explicit TDigest(double compression = 100.0);
+
+    /**
+     * @brief Cria um resumo vazio com o tamanho adequado a um erro desejado
+     * @param accuracy Erro de posição aproximado, como fração do total (ex.: 0.01 = 1%)
+     * @return Resumo com compression() = 1 / accuracy
+     * @throws std::invalid_argument se accuracy não estiver em (0, 1)
+     */
+    static TDigest forAccuracy(double accuracy);
+
+    /**
+     * @brief Adiciona um valor (NaN é ignorado)
+     * @param value Valor
+     * @param weight Peso (número de ocorrências)
+     */
+    void add(double value, double weight = 1.0);
+
+    /**
+     * @brief Adiciona vários valores (NaN é ignorado)
+     * @param values Valores
+     */
+    void add(std::span<const double> values);
+
+    /**
+     * @brief Combina outro resumo a este
+     * @param other Resumo de outro conjunto de valores
+     */
+    void merge(const TDigest& other);
+
+    /**
+     * @brief Funde os valores pendentes nos centroides
+     */
+    void compress();
+
+    /**
+     * @brief Calcula um quantil aproximado
+     * @param q Quantil (entre 0 e 1)
+     * @return Quantil aproximado (NaN se o resumo estiver vazio)
+     * @throws std::invalid_argument se q estiver fora de [0, 1]
+     */
+    double quantile(double q) const;
+
+    /**
+     * @brief Calcula vários quantis aproximados
+     * @param qs Quantis (entre 0 e 1)
+     * @return Quantis na ordem pedida
+     * @throws std::invalid_argument se algum quantil estiver fora de [0, 1]
+     */
+    std::vector<double> quantiles(std::span<const double> qs) const;
+
+    /**
+     * @brief Obtém o número de valores resumidos
+     * @return Soma dos pesos
+     */
+    double count() const { return m_count; }
+
+    /**
+     * @brief Verifica se o resumo está vazio
+     * @return true se nenhum valor foi adicionado
+     */
+    bool empty() const { return m_count == 0.0; }
+
+    /**
+     * @brief Obtém o menor valor resumido
+     * @return Mínimo exato (NaN se vazio)
+     */
+    double min() const { return empty() ? std::numeric_limits<double>::quiet_NaN() : m_min; }
+
+    /**
+     * @brief Obtém o maior valor resumido
+     * @return Máximo exato (NaN se vazio)
+     */
+    double max() const { return empty() ? std::numeric_limits<double>::quiet_NaN() : m_max; }
+
+    /**
+     * @brief Obtém o parâmetro de compressão
+     * @return Número aproximado máximo de centroides
+     */
+    double compression() const { return m_compression; }
+
+    /**
+     * @brief Obtém o número atual de centroides (após compress())
+     * @return Número de centroides
+     */
+    size_t centroidCount() const { return m_centroids.size(); }
+
+private:
+    struct Centroid {
+        double mean;    ///< Média dos valores do centroide
+        double weight;  ///< Número de valores
+    };
+
+    // Funde centroides (ordenados ou não) respeitando o limite da escala k1
+    static std::vector<Centroid> mergeCentroids(std::vector<Centroid> centroids, double compression);
+
+    double m_compression;                ///< Parâmetro de compressão (delta)
+    std::vector<Centroid> m_centroids;   ///< Centroides fundidos, ordenados pela média
+    std::vector<Centroid> m_buffer;      ///< Valores ainda não fundidos
+    double m_count = 0.0;                ///< Soma dos pesos
+    double m_min = std::numeric_limits<double>::infinity();    ///< Menor valor
+    double m_max = -std::numeric_limits<double>::infinity();   ///< Maior valor
+};
+
+} // namespace CPPandas
+
+#endif // CPPANDAS_QUANTILE_HPP
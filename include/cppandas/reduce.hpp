@@ -0,0 +1,182 @@
+/**
+ * @file reduce.hpp
+ * @brief Reduções numéricas vetorizadas (soma, soma dos quadrados, mínimo, máximo e contagem) e padronização
+ * @author CPPandas Team
+ */
+
+#ifndef CPPANDAS_REDUCE_HPP
+#define CPPANDAS_REDUCE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace CPPandas {
+
+/**
+ * @brief Resultado de uma redução: todas as estatísticas de uma única varredura
+ *
+ * As somas são acumuladas sobre os valores deslocados por @c shift (o
+ * primeiro valor válido), com compensação de Kahan por faixa do vetor, o
+ * que mantém a variância estável mesmo quando a média é grande em relação
+ * ao desvio padrão ou a coluna tem centenas de milhões de valores.
+ *
+ * Valores infinitos são contados à parte e não entram nas somas; como no
+ * pandas, a soma e a média passam a ser ±inf (NaN com os dois sinais) e a
+ * variância, NaN.
+ */
+struct Reduction {
+    size_t count = 0;                                           ///< Valores válidos (não NaN), incluindo infinitos
+    size_t positiveInfinities = 0;                              ///< Valores +inf
+    size_t negativeInfinities = 0;                              ///< Valores -inf
+    double min = std::numeric_limits<double>::quiet_NaN();      ///< Mínimo (NaN se count == 0)
+    double max = std::numeric_limits<double>::quiet_NaN();      ///< Máximo (NaN se count == 0)
+    double shift = 0.0;                                         ///< Deslocamento aplicado aos valores
+    double shiftedSum = 0.0;                                    ///< Soma de (x - shift), x finito
+    double shiftedSumsq = 0.0;                                  ///< Soma de (x - shift)^2, x finito
+
+    /**
+     * @brief Valor dominado pelos infinitos: +inf, -inf ou NaN se houver os dois sinais
+     * @return Valor, ou 0 se não houver infinitos
+     */
+    double infinity() const {
+        if (positiveInfinities > 0 && negativeInfinities > 0) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        if (positiveInfinities > 0) {
+            return std::numeric_limits<double>::infinity();
+        }
+        return negativeInfinities > 0 ? -std::numeric_limits<double>::infinity() : 0.0;
+    }
+
+    /**
+     * @brief Número de valores finitos
+     * @return Contagem
+     */
+    size_t finiteCount() const { return count - positiveInfinities - negativeInfinities; }
+
+    /**
+     * @brief Soma dos valores válidos
+     * @return Soma (0 se não houver valores)
+     */
+    double sum() const {
+        if (finiteCount() < count) {
+            return infinity();
+        }
+        return shiftedSum + shift * static_cast<double>(count);
+    }
+
+    /**
+     * @brief Soma dos quadrados dos valores válidos
+     * @return Soma dos quadrados (0 se não houver valores)
+     */
+    double sumsq() const {
+        if (finiteCount() < count) {
+            return std::numeric_limits<double>::infinity();
+        }
+        double n = static_cast<double>(count);
+        return shiftedSumsq + 2.0 * shift * shiftedSum + shift * shift * n;
+    }
+
+    /**
+     * @brief Média dos valores válidos
+     * @return Média ou NaN se não houver valores
+     */
+    double mean() const {
+        if (count == 0) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        if (finiteCount() < count) {
+            return infinity();
+        }
+        return shift + shiftedSum / static_cast<double>(count);
+    }
+
+    /**
+     * @brief Variância dos valores válidos
+     * @param ddof Graus de liberdade descontados (1 = amostral, como no pandas)
+     * @return Variância ou NaN se count <= ddof ou houver infinitos
+     */
+    double variance(size_t ddof = 1) const {
+        if (count <= ddof || finiteCount() < count) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        double n = static_cast<double>(count);
+        double squares = shiftedSumsq - shiftedSum * shiftedSum / n;
+        return std::max(squares, 0.0) / static_cast<double>(count - ddof);
+    }
+
+    /**
+     * @brief Desvio padrão dos valores válidos
+     * @param ddof Graus de liberdade descontados (1 = amostral, como no pandas)
+     * @return Desvio padrão ou NaN se count <= ddof
+     */
+    double stddev(size_t ddof = 1) const {
+        double value = variance(ddof);
+        return std::isnan(value) ? value : std::sqrt(value);
+    }
+};
+
+/**
+ * @brief Reduz uma coluna float64 em uma única varredura, ignorando NaN
+ *
+ * Usa AVX-512 ou AVX2 quando disponíveis (detectados na primeira chamada),
+ * com máscaras em vez de desvios para ignorar NaN, e um laço escalar nos
+ * demais casos.
+ *
+ * @param values Valores
+ * @return Contagem, soma, soma dos quadrados, mínimo e máximo
+ */
+Reduction reduce(std::span<const double> values);
+
+/**
+ * @brief Reduz uma coluna int64 em uma única varredura
+ * @param values Valores
+ * @return Contagem, soma, soma dos quadrados, mínimo e máximo
+ */
+Reduction reduce(std::span<const int64_t> values);
+
+/**
+ * @brief Reduz uma coluna booleana (0 ou 1) em uma única varredura
+ * @param values Valores
+ * @return Contagem, soma, soma dos quadrados, mínimo e máximo
+ */
+Reduction reduce(std::span<const uint8_t> values);
+
+/**
+ * @brief Padroniza valores: out[i] = (values[i] - mean) / scale
+ *
+ * Usa AVX-512 ou AVX2 quando disponíveis; NaN continua NaN. @p values e
+ * @p out podem ser o mesmo buffer, para a transformação em lugar.
+ *
+ * @param values Valores
+ * @param mean Valor subtraído
+ * @param scale Divisor
+ * @param out Destino, com o mesmo tamanho de @p values
+ */
+void standardize(std::span<const double> values, double mean, double scale, std::span<double> out);
+
+/**
+ * @brief Padroniza valores int64, convertendo-os para double
+ * @param values Valores
+ * @param mean Valor subtraído
+ * @param scale Divisor
+ * @param out Destino, com o mesmo tamanho de @p values
+ */
+void standardize(std::span<const int64_t> values, double mean, double scale, std::span<double> out);
+
+/**
+ * @brief Padroniza valores booleanos (0 ou 1), convertendo-os para double
+ * @param values Valores
+ * @param mean Valor subtraído
+ * @param scale Divisor
+ * @param out Destino, com o mesmo tamanho de @p values
+ */
+void standardize(std::span<const uint8_t> values, double mean, double scale, std::span<double> out);
+
+} // namespace CPPandas
+
+#endif // CPPANDAS_REDUCE_HPP
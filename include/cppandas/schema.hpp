@@ -0,0 +1,116 @@
+/**
+ * @file schema.hpp
+ * @brief Esquema de um conjunto de dados: nome e tipo de cada coluna
+ * @author CPPandas Team
+ */
+
+#ifndef CPPANDAS_SCHEMA_HPP
+#define CPPANDAS_SCHEMA_HPP
+
+#include "cppandas/column.hpp"
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace CPPandas {
+
+/**
+ * @class Schema
+ * @brief Lista ordenada de colunas e seus tipos de dados
+ *
+ * Preenchido uma única vez durante a leitura (por inferência ou a partir
+ * de um esquema explícito) e consultado pelas operações que dependem do
+ * tipo das colunas, sem reexaminar os valores.
+ *
+ * Exemplo de esquema explícito:
+ * @code
+ * ReadOptions options;
+ * options.schema = Schema{{"Year", DType::Int64}, {"Read_Date", DType::Datetime}};
+ * @endcode
+ */
+class Schema {
+public:
+    /**
+     * @brief Construtor padrão (esquema vazio)
+     */
+    Schema() = default;
+
+    /**
+     * @brief Cria um esquema a partir de pares (nome, tipo)
+     * @param fields Colunas na ordem desejada
+     */
+    Schema(std::initializer_list<std::pair<std::string, DType>> fields) {
+        for (const auto& field : fields) {
+            set(field.first, field.second);
+        }
+    }
+
+    /**
+     * @brief Define o tipo de uma coluna, adicionando-a se necessário
+     * @param name Nome da coluna
+     * @param dtype Tipo de dados
+     */
+    void set(const std::string& name, DType dtype) {
+        auto it = m_index.find(name);
+        if (it != m_index.end()) {
+            m_fields[it->second].second = dtype;
+            return;
+        }
+        m_index[name] = m_fields.size();
+        m_fields.emplace_back(name, dtype);
+    }
+
+    /**
+     * @brief Verifica se o esquema contém uma coluna
+     * @param name Nome da coluna
+     * @return true se a coluna existir
+     */
+    bool contains(const std::string& name) const {
+        return m_index.find(name) != m_index.end();
+    }
+
+    /**
+     * @brief Obtém o tipo de uma coluna
+     * @param name Nome da coluna
+     * @return Tipo de dados
+     * @throws std::out_of_range se a coluna não existir
+     */
+    DType dtype(const std::string& name) const {
+        auto it = m_index.find(name);
+        if (it == m_index.end()) {
+            throw std::out_of_range("Column not in schema: " + name);
+        }
+        return m_fields[it->second].second;
+    }
+
+    /**
+     * @brief Obtém as colunas na ordem do esquema
+     * @return Pares (nome, tipo)
+     */
+    const std::vector<std::pair<std::string, DType>>& fields() const { return m_fields; }
+
+    /**
+     * @brief Obtém o número de colunas
+     * @return Número de colunas
+     */
+    size_t size() const { return m_fields.size(); }
+
+    /**
+     * @brief Verifica se o esquema está vazio
+     * @return true se não houver colunas
+     */
+    bool empty() const { return m_fields.empty(); }
+
+    bool operator==(const Schema& other) const { return m_fields == other.m_fields; }
+
+private:
+    std::vector<std::pair<std::string, DType>> m_fields;   ///< Colunas em ordem
+    std::unordered_map<std::string, size_t> m_index;      ///< Nome -> posição em m_fields
+};
+
+} // namespace CPPandas
+
+#endif // CPPANDAS_SCHEMA_HPP
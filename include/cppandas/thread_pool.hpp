@@ -0,0 +1,149 @@
+/**
+ * @file thread_pool.hpp
+ * @brief Pool de threads com roubo de tarefas para execução em paralelo
+ * @author CPPandas Team
+ */
+
+#ifndef CPPANDAS_THREAD_POOL_HPP
+#define CPPANDAS_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace CPPandas {
+
+/**
+ * @class ThreadPool
+ * @brief Pool com um número fixo de threads e roubo de tarefas (work stealing)
+ *
+ * Cada thread tem sua própria fila: tarefas enfileiradas por uma thread do
+ * pool vão para a fila dela e são executadas na ordem inversa (LIFO, que
+ * aproveita o cache), enquanto threads ociosas roubam as tarefas mais
+ * antigas das filas das demais. Tarefas enfileiradas de fora do pool são
+ * distribuídas entre as filas.
+ *
+ * A biblioteca usa um pool compartilhado, global(), criado sob demanda na
+ * primeira operação paralela.
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief Cria o pool e inicia as threads
+     * @param numThreads Número de threads (0 = número de núcleos disponíveis)
+     */
+    explicit ThreadPool(size_t numThreads = 0);
+
+    /**
+     * @brief Aguarda as tarefas pendentes e encerra as threads
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Obtém o número de threads do pool
+     * @return Número de threads
+     */
+    size_t size() const { return m_workers.size(); }
+
+    /**
+     * @brief Enfileira uma tarefa
+     * @param task Função sem argumentos a ser executada
+     * @return std::future com o resultado (ou a exceção) da tarefa
+     */
+    template <typename Func>
+    auto submit(Func&& task) -> std::future<std::invoke_result_t<Func>> {
+        using Result = std::invoke_result_t<Func>;
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<Func>(task));
+        std::future<Result> future = packaged->get_future();
+        enqueue([packaged]() { (*packaged)(); });
+        return future;
+    }
+
+    /**
+     * @brief Executa body(i) para cada i em [0, count) e aguarda o término
+     *
+     * As iterações são distribuídas dinamicamente entre as threads do pool
+     * e a thread que chama, que também executa iterações enquanto espera.
+     * Por isso parallelFor pode ser chamado de dentro de uma tarefa do
+     * próprio pool sem risco de bloqueio.
+     *
+     * Se alguma iteração lançar uma exceção, a primeira delas é relançada
+     * após todas as iterações terminarem.
+     *
+     * @param count Número de iterações
+     * @param body Função chamada com o índice da iteração
+     */
+    void parallelFor(size_t count, const std::function<void(size_t)>& body);
+
+    /**
+     * @brief Obtém o número padrão de threads (núcleos disponíveis)
+     * @return Número de threads, no mínimo 1
+     */
+    static size_t defaultThreadCount();
+
+    /**
+     * @brief Obtém o pool compartilhado pela biblioteca
+     *
+     * Criado na primeira chamada, com setGlobalThreadCount() threads, a menos
+     * que um pool tenha sido fornecido com setGlobal().
+     *
+     * @return Pool compartilhado
+     */
+    static std::shared_ptr<ThreadPool> global();
+
+    /**
+     * @brief Substitui o pool compartilhado por um pool do usuário
+     *
+     * Operações em andamento terminam no pool anterior, que é destruído
+     * quando deixar de ser usado.
+     *
+     * @param pool Pool a ser usado (nullptr = voltar ao pool padrão, criado sob demanda)
+     */
+    static void setGlobal(std::shared_ptr<ThreadPool> pool);
+
+    /**
+     * @brief Define o número de threads do pool compartilhado padrão
+     *
+     * Se o pool padrão já tiver sido criado, ele é substituído na próxima
+     * chamada a global().
+     *
+     * @param numThreads Número de threads (0 = número de núcleos disponíveis)
+     */
+    static void setGlobalThreadCount(size_t numThreads);
+
+private:
+    /**
+     * @brief Fila de tarefas de uma thread do pool
+     */
+    struct WorkerQueue {
+        std::mutex mutex;                           ///< Protege a fila
+        std::deque<std::function<void()>> tasks;    ///< Tarefas pendentes
+    };
+
+    void enqueue(std::function<void()> task);
+    bool tryPop(size_t worker, std::function<void()>& task);
+    void workerLoop(size_t worker);
+
+    std::vector<std::thread> m_workers;                   ///< Threads do pool
+    std::vector<std::unique_ptr<WorkerQueue>> m_queues;   ///< Uma fila por thread
+    std::atomic<size_t> m_queued{0};                      ///< Tarefas pendentes em todas as filas
+    std::atomic<size_t> m_nextQueue{0};                   ///< Próxima fila para tarefas externas
+    std::mutex m_mutex;                                   ///< Protege a espera por tarefas
+    std::condition_variable m_condition;                  ///< Sinaliza novas tarefas
+    bool m_stopping = false;                              ///< Se o pool está sendo encerrado
+};
+
+} // namespace CPPandas
+
+#endif // CPPANDAS_THREAD_POOL_HPP
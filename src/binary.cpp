@@ -0,0 +1,367 @@
+/**
+ * @file binary.cpp
+ * @brief Leitura e escrita do formato binário colunar (saveBinary/loadBinary)
+ */
+
+#include "cppandas/csv.hpp"
+#include "cppandas/mapped_file.hpp"
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+namespace CPPandas {
+
+namespace {
+
+constexpr char kMagic[8] = {'C', 'P', 'D', 'B', 'I', 'N', '0', '1'};
+constexpr uint64_t kVersion = 1;
+constexpr uint64_t kByteOrderMark = 0x0102030405060708ULL;
+constexpr uint64_t kAlignment = 64;
+constexpr uint64_t kHeaderSize = 64;
+constexpr uint64_t kTrailerSize = 16;
+
+// Posição dos blocos de uma coluna no arquivo
+struct ColumnLayout {
+    std::string name;
+    uint64_t dtype = 0;
+    uint64_t nullCount = 0;
+    uint64_t valuesOffset = 0;    // Valores, códigos de categorias ou deslocamentos do texto
+    uint64_t valuesBytes = 0;
+    uint64_t validityOffset = 0;  // 0 = sem nulos
+    uint64_t dataOffset = 0;      // Conteúdo do texto, ou dicionário de categorias
+    uint64_t dataBytes = 0;
+};
+
+class BinaryWriter {
+public:
+    explicit BinaryWriter(std::ofstream& file) : m_file(file) {}
+
+    uint64_t position() const { return m_position; }
+
+    void write(const void* data, size_t size) {
+        m_file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        m_position += size;
+    }
+
+    void writeU64(uint64_t value) { write(&value, sizeof(value)); }
+
+    void align() {
+        static const char zeros[kAlignment] = {};
+        write(zeros, (kAlignment - m_position % kAlignment) % kAlignment);
+    }
+
+    // Escreve um bloco alinhado e retorna sua posição
+    uint64_t writeBlock(const void* data, size_t size) {
+        align();
+        uint64_t offset = m_position;
+        write(data, size);
+        return offset;
+    }
+
+private:
+    std::ofstream& m_file;
+    uint64_t m_position = 0;
+};
+
+class BinaryReader {
+public:
+    BinaryReader(const char* data, uint64_t begin, uint64_t end) : m_data(data), m_position(begin), m_end(end) {}
+
+    bool readU64(uint64_t& value) {
+        if (m_end - m_position < sizeof(value)) {
+            return false;
+        }
+        std::memcpy(&value, m_data + m_position, sizeof(value));
+        m_position += sizeof(value);
+        return true;
+    }
+
+    bool readString(std::string& value, uint64_t size) {
+        if (m_end - m_position < size) {
+            return false;
+        }
+        value.assign(m_data + m_position, size);
+        m_position += size;
+        return true;
+    }
+
+private:
+    const char* m_data;
+    uint64_t m_position;
+    uint64_t m_end;
+};
+
+size_t valueWidth(DType dtype) {
+    return dtype == DType::Bool ? 1 : 8;
+}
+
+uint64_t valuesBytes(const ColumnBuffer& column) {
+    switch (column.dtype()) {
+        case DType::String:   return (column.size() + 1) * sizeof(uint64_t);
+        case DType::Category: return column.size() * ColumnBuffer::categoryCodeWidth(column.categories().size());
+        default:              return column.size() * valueWidth(column.dtype());
+    }
+}
+
+// Escreve o dicionário de categorias: número de categorias, deslocamentos
+// (um a mais que as categorias) e o texto
+uint64_t writeDictionary(BinaryWriter& writer, std::span<const std::string_view> categories) {
+    writer.writeU64(categories.size());
+    uint64_t total = 0;
+    writer.writeU64(0);
+    for (std::string_view category : categories) {
+        total += category.size();
+        writer.writeU64(total);
+    }
+    for (std::string_view category : categories) {
+        writer.write(category.data(), category.size());
+    }
+    return (categories.size() + 2) * sizeof(uint64_t) + total;
+}
+
+// Lê o dicionário escrito por writeDictionary(), sem copiar o texto
+bool readDictionary(const char* block, uint64_t bytes, std::vector<std::string_view>& categories) {
+    uint64_t count = 0;
+    if (bytes < 2 * sizeof(uint64_t)) {
+        return false;
+    }
+    std::memcpy(&count, block, sizeof(count));
+    if (count > bytes / sizeof(uint64_t) - 2) {
+        return false;
+    }
+    const uint64_t* offsets = reinterpret_cast<const uint64_t*>(block) + 1;
+    const char* text = block + (count + 2) * sizeof(uint64_t);
+    const uint64_t textBytes = bytes - (count + 2) * sizeof(uint64_t);
+    categories.reserve(count);
+    for (uint64_t i = 0; i < count; ++i) {
+        if (offsets[i] > offsets[i + 1] || offsets[i + 1] > textBytes) {
+            return false;
+        }
+        categories.emplace_back(text + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+    return true;
+}
+
+// Verifica se todos os códigos indexam o dicionário (ou indicam nulo)
+template <typename Code>
+bool validCodes(const char* block, uint64_t rowCount, uint64_t categoryCount) {
+    const Code* codes = reinterpret_cast<const Code*>(block);
+    for (uint64_t row = 0; row < rowCount; ++row) {
+        if (codes[row] >= categoryCount && codes[row] != std::numeric_limits<Code>::max()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Verifica se [offset, offset + bytes) está dentro da área de dados e alinhado
+bool validBlock(uint64_t offset, uint64_t bytes, uint64_t limit) {
+    return offset % kAlignment == 0 && offset >= kHeaderSize && offset <= limit && bytes <= limit - offset;
+}
+
+} // namespace
+
+bool CSV::saveBinary(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    BinaryWriter writer(file);
+
+    char header[kHeaderSize] = {};
+    std::memcpy(header, kMagic, sizeof(kMagic));
+    std::memcpy(header + 8, &kVersion, sizeof(kVersion));
+    std::memcpy(header + 16, &kByteOrderMark, sizeof(kByteOrderMark));
+    writer.write(header, sizeof(header));
+
+    std::vector<ColumnLayout> layouts(m_columns.size());
+    for (size_t i = 0; i < m_columns.size(); ++i) {
+        const ColumnBuffer& column = m_columns[i];
+        ColumnLayout& layout = layouts[i];
+        layout.name = m_headers[i];
+        layout.dtype = static_cast<uint64_t>(column.dtype());
+        layout.nullCount = column.nullCount();
+
+        switch (column.dtype()) {
+            case DType::Float64:
+                layout.valuesOffset = writer.writeBlock(column.float64().data(), column.float64().size_bytes());
+                break;
+            case DType::Int64:
+                layout.valuesOffset = writer.writeBlock(column.int64().data(), column.int64().size_bytes());
+                break;
+            case DType::Datetime:
+                layout.valuesOffset = writer.writeBlock(column.datetime().data(), column.datetime().size_bytes());
+                break;
+            case DType::Bool:
+                layout.valuesOffset = writer.writeBlock(column.boolean().data(), column.boolean().size_bytes());
+                break;
+            case DType::String: {
+                std::span<const std::string_view> strings = column.strings();
+                std::vector<uint64_t> offsets;
+                offsets.reserve(strings.size() + 1);
+                uint64_t total = 0;
+                offsets.push_back(0);
+                for (std::string_view value : strings) {
+                    total += value.size();
+                    offsets.push_back(total);
+                }
+                layout.valuesOffset = writer.writeBlock(offsets.data(), offsets.size() * sizeof(uint64_t));
+                writer.align();
+                layout.dataOffset = writer.position();
+                for (std::string_view value : strings) {
+                    writer.write(value.data(), value.size());
+                }
+                layout.dataBytes = total;
+                break;
+            }
+            case DType::Category:
+                layout.valuesOffset = column.visitCodes([&writer](auto codes) {
+                    return writer.writeBlock(codes.data(), codes.size_bytes());
+                }, uint64_t(0));
+                writer.align();
+                layout.dataOffset = writer.position();
+                layout.dataBytes = writeDictionary(writer, column.categories());
+                break;
+        }
+        layout.valuesBytes = valuesBytes(column);
+
+        if (layout.nullCount > 0) {
+            std::span<const uint64_t> words = column.validity().words();
+            layout.validityOffset = writer.writeBlock(words.data(), words.size_bytes());
+        }
+    }
+
+    // Rodapé com o esquema
+    writer.align();
+    uint64_t footerOffset = writer.position();
+    writer.writeU64(m_rowCount);
+    writer.writeU64(layouts.size());
+    for (const ColumnLayout& layout : layouts) {
+        writer.writeU64(layout.name.size());
+        writer.write(layout.name.data(), layout.name.size());
+        writer.writeU64(layout.dtype);
+        writer.writeU64(layout.nullCount);
+        writer.writeU64(layout.valuesOffset);
+        writer.writeU64(layout.valuesBytes);
+        writer.writeU64(layout.validityOffset);
+        writer.writeU64(layout.dataOffset);
+        writer.writeU64(layout.dataBytes);
+    }
+    writer.writeU64(footerOffset);
+    writer.write(kMagic, sizeof(kMagic));
+
+    return file.good();
+}
+
+bool CSV::loadBinary(const std::string& filename) {
+    std::shared_ptr<const MappedFile> mapped = MappedFile::open(filename);
+    if (!mapped || mapped->size() < kHeaderSize + kTrailerSize) {
+        return false;
+    }
+    const char* data = mapped->data();
+    const uint64_t size = mapped->size();
+
+    uint64_t version = 0;
+    uint64_t byteOrder = 0;
+    std::memcpy(&version, data + 8, sizeof(version));
+    std::memcpy(&byteOrder, data + 16, sizeof(byteOrder));
+    if (std::memcmp(data, kMagic, sizeof(kMagic)) != 0 ||
+        std::memcmp(data + size - sizeof(kMagic), kMagic, sizeof(kMagic)) != 0 ||
+        version != kVersion || byteOrder != kByteOrderMark) {
+        return false;
+    }
+
+    uint64_t footerOffset = 0;
+    std::memcpy(&footerOffset, data + size - kTrailerSize, sizeof(footerOffset));
+    if (footerOffset < kHeaderSize || footerOffset > size - kTrailerSize) {
+        return false;
+    }
+
+    BinaryReader reader(data, footerOffset, size - kTrailerSize);
+    uint64_t rowCount = 0;
+    uint64_t columnCount = 0;
+    if (!reader.readU64(rowCount) || !reader.readU64(columnCount) || rowCount > size) {
+        return false;
+    }
+
+    VectorStr headers;
+    std::vector<ColumnBuffer> columns;
+    for (uint64_t i = 0; i < columnCount; ++i) {
+        ColumnLayout layout;
+        uint64_t nameLength = 0;
+        if (!reader.readU64(nameLength) || !reader.readString(layout.name, nameLength) ||
+            !reader.readU64(layout.dtype) || !reader.readU64(layout.nullCount) ||
+            !reader.readU64(layout.valuesOffset) || !reader.readU64(layout.valuesBytes) ||
+            !reader.readU64(layout.validityOffset) || !reader.readU64(layout.dataOffset) ||
+            !reader.readU64(layout.dataBytes)) {
+            return false;
+        }
+        if (layout.dtype > static_cast<uint64_t>(DType::Category) || layout.nullCount > rowCount) {
+            return false;
+        }
+        DType dtype = static_cast<DType>(layout.dtype);
+
+        if (dtype == DType::String) {
+            if (layout.valuesBytes != (rowCount + 1) * sizeof(uint64_t) ||
+                !validBlock(layout.valuesOffset, layout.valuesBytes, footerOffset) ||
+                !validBlock(layout.dataOffset, layout.dataBytes, footerOffset)) {
+                return false;
+            }
+            const uint64_t* offsets = reinterpret_cast<const uint64_t*>(data + layout.valuesOffset);
+            const char* text = data + layout.dataOffset;
+            std::vector<std::string_view> views;
+            views.reserve(rowCount);
+            for (uint64_t row = 0; row < rowCount; ++row) {
+                if (offsets[row] > offsets[row + 1] || offsets[row + 1] > layout.dataBytes) {
+                    return false;
+                }
+                views.emplace_back(text + offsets[row], offsets[row + 1] - offsets[row]);
+            }
+            columns.push_back(ColumnBuffer::fromViews(std::move(views), DType::String, mapped));
+        } else if (dtype == DType::Category) {
+            std::vector<std::string_view> categories;
+            if (!validBlock(layout.dataOffset, layout.dataBytes, footerOffset) ||
+                !readDictionary(data + layout.dataOffset, layout.dataBytes, categories)) {
+                return false;
+            }
+            size_t width = ColumnBuffer::categoryCodeWidth(categories.size());
+            const char* codes = data + layout.valuesOffset;
+            if (layout.valuesBytes != rowCount * width ||
+                !validBlock(layout.valuesOffset, layout.valuesBytes, footerOffset)) {
+                return false;
+            }
+            bool valid = width == 1 ? validCodes<uint8_t>(codes, rowCount, categories.size())
+                       : width == 2 ? validCodes<uint16_t>(codes, rowCount, categories.size())
+                                    : validCodes<uint32_t>(codes, rowCount, categories.size());
+            if (!valid) {
+                return false;
+            }
+            columns.push_back(ColumnBuffer::fromCodes(std::move(categories), codes, rowCount, mapped));
+        } else {
+            if (layout.valuesBytes != rowCount * valueWidth(dtype) ||
+                !validBlock(layout.valuesOffset, layout.valuesBytes, footerOffset)) {
+                return false;
+            }
+
+            Bitmap validity(rowCount, true);
+            if (layout.nullCount > 0) {
+                uint64_t words = Bitmap::wordCount(rowCount);
+                if (!validBlock(layout.validityOffset, words * sizeof(uint64_t), footerOffset)) {
+                    return false;
+                }
+                const uint64_t* bits = reinterpret_cast<const uint64_t*>(data + layout.validityOffset);
+                for (uint64_t w = 0; w < words; ++w) {
+                    validity.setWord(w, bits[w]);
+                }
+            }
+            columns.push_back(ColumnBuffer::fromExternal(dtype, data + layout.valuesOffset, rowCount,
+                                                         std::move(validity), mapped));
+        }
+        headers.push_back(std::move(layout.name));
+    }
+
+    *this = fromColumns(std::move(headers), std::move(columns));
+    return true;
+}
+
+} // namespace CPPandas
@@ -0,0 +1,851 @@
+/**
+ * @file column.cpp
+ * @brief Implementação do armazenamento colunar tipado
+ */
+
+#include "cppandas/column.hpp"
+#include "cppandas/frequency.hpp"
+#include "cppandas/quantile.hpp"
+#include "string_arena.hpp"
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_set>
+
+namespace CPPandas {
+
+struct ColumnBuffer::SortCache {
+    std::atomic<size_t> queries{0};  ///< Consultas de quantis já feitas
+    std::once_flag sortOnce;         ///< Ordenação feita uma única vez
+    std::vector<double> sorted;      ///< Valores válidos em ordem crescente
+};
+
+const char* dtypeName(DType dtype) {
+    switch (dtype) {
+        case DType::Float64: return "float64";
+        case DType::Int64:   return "int64";
+        case DType::Bool:    return "bool";
+        case DType::Datetime: return "datetime64[ns]";
+        case DType::String:  return "string";
+        case DType::Category: return "category";
+    }
+    return "object";
+}
+
+DType dtypeFromName(std::string_view name) {
+    if (name == "float64" || name == "float") return DType::Float64;
+    if (name == "int64" || name == "int") return DType::Int64;
+    if (name == "bool") return DType::Bool;
+    if (name == "datetime64[ns]" || name == "datetime") return DType::Datetime;
+    if (name == "string" || name == "str" || name == "object") return DType::String;
+    if (name == "category") return DType::Category;
+    throw std::invalid_argument("Unknown dtype: " + std::string(name));
+}
+
+ColumnBuffer ColumnBuffer::fromStrings(std::vector<std::string> cells) {
+    // Sem dono, o texto é copiado para uma arena da coluna e as strings,
+    // uma alocação cada, são liberadas ao fim da chamada
+    std::vector<std::string_view> views(cells.begin(), cells.end());
+    return fromViews(std::move(views));
+}
+
+namespace {
+
+// Copia os campos para uma arena, em um único bloco, e os redireciona para a cópia
+std::shared_ptr<const void> copyToArena(std::span<std::string_view> cells) {
+    size_t total = 0;
+    for (std::string_view cell : cells) {
+        total += cell.size();
+    }
+    auto arena = std::make_shared<detail::StringArena>();
+    arena->reserve(total);
+    for (std::string_view& cell : cells) {
+        cell = arena->append(cell);
+    }
+    return arena;
+}
+
+// Converte todos os campos com parse; campos nulos (isNullValue()) ou inválidos recebem
+// nullValue. Em modo estrito, um campo não vazio inválido interrompe a
+// conversão e o resultado é false.
+template <typename T, typename Parse>
+bool convertCells(std::span<const std::string_view> cells, std::vector<T>& values, T nullValue,
+                  bool strict, size_t& nullCount, Parse parse) {
+    values.resize(cells.size());
+    for (size_t i = 0; i < cells.size(); ++i) {
+        if (isNullValue(cells[i])) {
+            values[i] = nullValue;
+            nullCount++;
+            continue;
+        }
+        auto parsed = parse(cells[i]);
+        if (parsed.ok()) {
+            values[i] = static_cast<T>(parsed.value);
+        } else if (strict) {
+            return false;
+        } else {
+            values[i] = nullValue;
+            nullCount++;
+        }
+    }
+    return true;
+}
+
+// Tipo usado quando um valor não cabe no tipo inferido por amostragem
+DType widerType(DType dtype) {
+    return dtype == DType::Int64 ? DType::Float64 : DType::String;
+}
+
+} // namespace
+
+DType ColumnBuffer::inferDType(std::span<const std::string_view> cells, size_t sampleRows) {
+    size_t sampleCount = cells.size();
+    if (sampleRows > 0 && sampleRows < cells.size()) {
+        sampleCount = sampleRows;
+    }
+
+    size_t nonEmptyCount = 0;
+    bool hasNull = false;
+    bool allInt = true;
+    bool allBool = true;
+    bool allNumeric = true;
+    bool allDatetime = true;
+
+    for (size_t k = 0; k < sampleCount; ++k) {
+        std::string_view cell = cells[k * cells.size() / sampleCount];
+        if (isNullValue(cell)) {
+            hasNull = true;
+            continue;
+        }
+        nonEmptyCount++;
+
+        if (allInt && !parseInt64(cell).ok()) allInt = false;
+        if (allBool && !parseBool(cell).ok()) allBool = false;
+        if (allNumeric && !allInt && !parseDouble(cell).ok()) allNumeric = false;
+        // Números não são datas; as demais células precisam ser datas válidas
+        if (allDatetime && (allNumeric || !parseDatetime(cell).ok())) allDatetime = false;
+
+        if (!allInt && !allBool && !allNumeric && !allDatetime) {
+            return DType::String;
+        }
+    }
+
+    // Amostra sem valores em uma coluna que os tem: examinar tudo
+    if (nonEmptyCount == 0 && sampleCount < cells.size() &&
+        std::any_of(cells.begin(), cells.end(), [](std::string_view cell) { return !isNullValue(cell); })) {
+        return inferDType(cells, 0);
+    }
+
+    // Inteiros e booleanos não têm representação de nulo: colunas com valores
+    // ausentes são promovidas como no pandas (int64 -> float64, bool -> string).
+    // Marcadores como "NA" ou campos só com espaços também são nulos; fora da
+    // amostra eles só importam para esses dois tipos
+    if (!hasNull && sampleCount < cells.size() && (allBool || allInt)) {
+        hasNull = std::any_of(cells.begin(), cells.end(), [](std::string_view cell) { return isNullValue(cell); });
+    }
+    if (nonEmptyCount > 0 && !hasNull && allBool) {
+        return DType::Bool;
+    }
+    if (nonEmptyCount > 0 && !hasNull && allInt) {
+        return DType::Int64;
+    }
+
+    // Colunas sem nenhum valor também são float64 (todas NaN), como no pandas
+    if (allNumeric || allInt || nonEmptyCount == 0) {
+        return DType::Float64;
+    }
+    if (allDatetime) {
+        return DType::Datetime;
+    }
+    return DType::String;
+}
+
+ColumnBuffer ColumnBuffer::fromViews(std::vector<std::string_view> cells, std::shared_ptr<const void> owner,
+                                     size_t sampleRows) {
+    DType dtype = inferDType(cells, sampleRows);
+
+    // Com amostragem, um valor não examinado pode não caber no tipo inferido
+    ColumnBuffer column;
+    while (!column.convertFrom(cells, dtype, owner, true)) {
+        dtype = widerType(dtype);
+    }
+    column.buildValidity();
+    return column;
+}
+
+ColumnBuffer ColumnBuffer::fromViews(std::vector<std::string_view> cells, std::shared_ptr<const void> owner,
+                                     size_t sampleRows, DType atLeast) {
+    DType dtype = commonDType(inferDType(cells, sampleRows), atLeast);
+
+    ColumnBuffer column;
+    while (!column.convertFrom(cells, dtype, owner, true)) {
+        dtype = widerType(dtype);
+    }
+    column.buildValidity();
+    return column;
+}
+
+DType ColumnBuffer::commonDType(DType a, DType b) {
+    if (a == b) {
+        return a;
+    }
+    if ((a == DType::Int64 || a == DType::Float64) && (b == DType::Int64 || b == DType::Float64)) {
+        return DType::Float64;
+    }
+    return DType::String;
+}
+
+ColumnBuffer ColumnBuffer::fromViews(std::vector<std::string_view> cells, DType dtype,
+                                     std::shared_ptr<const void> owner) {
+    ColumnBuffer column;
+    column.convertFrom(cells, dtype, owner, false);
+    column.buildValidity();
+    return column;
+}
+
+bool ColumnBuffer::convertFrom(std::vector<std::string_view>& cells, DType dtype,
+                               const std::shared_ptr<const void>& owner, bool strict) {
+    size_t nullCount = 0;
+
+    switch (dtype) {
+        case DType::Float64: {
+            std::vector<double> values;
+            if (!convertCells(cells, values, std::numeric_limits<double>::quiet_NaN(), strict, nullCount,
+                              [](std::string_view cell) { return parseDouble(cell); })) {
+                return false;
+            }
+            m_float64 = ValueBuffer<double>(std::move(values));
+            m_dtype = DType::Float64;
+            return true;
+        }
+
+        case DType::Int64: {
+            std::vector<int64_t> values;
+            if (!convertCells(cells, values, int64_t(0), strict, nullCount,
+                              [](std::string_view cell) { return parseInt64(cell); })) {
+                return false;
+            }
+            if (nullCount > 0) {
+                return convertFrom(cells, DType::Float64, owner, strict);
+            }
+            m_int64 = ValueBuffer<int64_t>(std::move(values));
+            m_dtype = DType::Int64;
+            return true;
+        }
+
+        case DType::Bool: {
+            std::vector<uint8_t> values;
+            if (!convertCells(cells, values, uint8_t(0), strict, nullCount,
+                              [](std::string_view cell) { return parseBool(cell); })) {
+                return false;
+            }
+            if (nullCount > 0) {
+                return convertFrom(cells, DType::String, owner, strict);
+            }
+            m_bool = ValueBuffer<uint8_t>(std::move(values));
+            m_dtype = DType::Bool;
+            return true;
+        }
+
+        case DType::Datetime: {
+            std::vector<int64_t> values;
+            if (!convertCells(cells, values, kNaT, strict, nullCount,
+                              [](std::string_view cell) { return parseDatetime(cell); })) {
+                return false;
+            }
+            m_int64 = ValueBuffer<int64_t>(std::move(values));
+            m_dtype = DType::Datetime;
+            return true;
+        }
+
+        case DType::Category:
+            encodeCategories(cells);
+            return true;
+
+        case DType::String:
+            break;
+    }
+
+    m_dtype = DType::String;
+
+    // Nulos de texto são views vazias
+    for (std::string_view& cell : cells) {
+        if (!cell.empty() && isNullValue(cell)) {
+            cell = std::string_view();
+        }
+    }
+
+    // Sem dono externo, os campos são copiados para uma arena própria
+    m_storage = owner ? owner : copyToArena(cells);
+    m_strings = ValueBuffer<std::string_view>(std::move(cells));
+    return true;
+}
+
+namespace {
+
+// Reduz os códigos à largura T; kNullCode passa a ser o maior valor de T
+template <typename T>
+std::vector<T> narrowCodes(std::span<const uint32_t> codes) {
+    std::vector<T> narrowed(codes.size());
+    for (size_t i = 0; i < codes.size(); ++i) {
+        narrowed[i] = codes[i] == ColumnBuffer::kNullCode ? std::numeric_limits<T>::max()
+                                                          : static_cast<T>(codes[i]);
+    }
+    return narrowed;
+}
+
+} // namespace
+
+void ColumnBuffer::encodeCategories(std::span<const std::string_view> values) {
+    FrequencyTable<std::string_view> dictionary;
+    std::vector<uint32_t> codes(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        codes[i] = isNullValue(values[i]) ? kNullCode : static_cast<uint32_t>(dictionary.add(values[i], i));
+    }
+
+    std::vector<std::string_view> categories;
+    categories.reserve(dictionary.size());
+    for (const auto& entry : dictionary.entries()) {
+        categories.push_back(entry.key);
+    }
+    m_storage = copyToArena(categories);
+    m_strings = ValueBuffer<std::string_view>(std::move(categories));
+    m_dtype = DType::Category;
+    assignCodes(codes);
+}
+
+void ColumnBuffer::assignCodes(std::span<const uint32_t> codes) {
+    switch (categoryCodeWidth(m_strings.size())) {
+        case 1:  m_codes8 = ValueBuffer<uint8_t>(narrowCodes<uint8_t>(codes)); break;
+        case 2:  m_codes16 = ValueBuffer<uint16_t>(narrowCodes<uint16_t>(codes)); break;
+        default: m_codes32 = ValueBuffer<uint32_t>(std::vector<uint32_t>(codes.begin(), codes.end())); break;
+    }
+}
+
+std::vector<std::string_view> ColumnBuffer::decodeCategories() const {
+    std::vector<std::string_view> cells(size());
+    for (size_t i = 0; i < cells.size(); ++i) {
+        uint32_t category = code(i);
+        cells[i] = category == kNullCode ? std::string_view() : m_strings[category];
+    }
+    return cells;
+}
+
+ColumnBuffer ColumnBuffer::fromCodes(std::vector<std::string_view> categories, const void* codes, size_t size,
+                                     std::shared_ptr<const void> owner) {
+    ColumnBuffer column;
+    column.m_dtype = DType::Category;
+    column.m_strings = ValueBuffer<std::string_view>(std::move(categories));
+    switch (categoryCodeWidth(column.m_strings.size())) {
+        case 1:  column.m_codes8 = ValueBuffer<uint8_t>(static_cast<const uint8_t*>(codes), size, owner); break;
+        case 2:  column.m_codes16 = ValueBuffer<uint16_t>(static_cast<const uint16_t*>(codes), size, owner); break;
+        default: column.m_codes32 = ValueBuffer<uint32_t>(static_cast<const uint32_t*>(codes), size, owner); break;
+    }
+    column.m_storage = std::move(owner);
+    column.buildValidity();
+    return column;
+}
+
+ColumnBuffer ColumnBuffer::astype(DType dtype) const {
+    if (dtype == m_dtype) {
+        return *this;
+    }
+
+    if (dtype == DType::Category && m_dtype == DType::String) {
+        ColumnBuffer column;
+        column.encodeCategories(m_strings);
+        column.buildValidity();
+        return column;
+    }
+
+    // Texto e categorias são convertidos pelos próprios campos; os demais
+    // tipos passam pela representação textual de cada valor
+    std::vector<std::string_view> cells;
+    std::shared_ptr<const void> owner = m_storage;
+    if (m_dtype == DType::String) {
+        cells.assign(m_strings.begin(), m_strings.end());
+    } else if (m_dtype == DType::Category) {
+        cells = decodeCategories();
+    } else {
+        auto texts = std::make_shared<detail::StringArena>();
+        cells.resize(size());
+        for (size_t i = 0; i < cells.size(); ++i) {
+            cells[i] = texts->append(getString(i));
+        }
+        owner = std::move(texts);
+    }
+    return fromViews(std::move(cells), dtype, std::move(owner));
+}
+
+ColumnBuffer ColumnBuffer::fromFloat64(std::vector<double> values) {
+    ColumnBuffer column;
+    column.m_dtype = DType::Float64;
+    column.m_float64 = ValueBuffer<double>(std::move(values));
+    column.buildValidity();
+    return column;
+}
+
+ColumnBuffer ColumnBuffer::fromInt64(std::vector<int64_t> values) {
+    ColumnBuffer column;
+    column.m_dtype = DType::Int64;
+    column.m_int64 = ValueBuffer<int64_t>(std::move(values));
+    column.buildValidity();
+    return column;
+}
+
+ColumnBuffer ColumnBuffer::fromBool(std::vector<uint8_t> values) {
+    ColumnBuffer column;
+    column.m_dtype = DType::Bool;
+    column.m_bool = ValueBuffer<uint8_t>(std::move(values));
+    column.buildValidity();
+    return column;
+}
+
+ColumnBuffer ColumnBuffer::fromDatetime(std::vector<int64_t> values) {
+    ColumnBuffer column;
+    column.m_dtype = DType::Datetime;
+    column.m_int64 = ValueBuffer<int64_t>(std::move(values));
+    column.buildValidity();
+    return column;
+}
+
+namespace {
+
+template <typename T>
+std::vector<T> gather(std::span<const T> values, std::span<const size_t> indices) {
+    std::vector<T> result;
+    result.reserve(indices.size());
+    for (size_t index : indices) {
+        if (index >= values.size()) {
+            throw std::out_of_range("Row index out of range");
+        }
+        result.push_back(values[index]);
+    }
+    return result;
+}
+
+} // namespace
+
+ColumnBuffer ColumnBuffer::take(std::span<const size_t> indices) const {
+    ColumnBuffer column;
+    column.m_dtype = m_dtype;
+    switch (m_dtype) {
+        case DType::Float64:  column.m_float64 = ValueBuffer<double>(gather<double>(m_float64, indices)); break;
+        case DType::Int64:
+        case DType::Datetime: column.m_int64 = ValueBuffer<int64_t>(gather<int64_t>(m_int64, indices)); break;
+        case DType::Bool:     column.m_bool = ValueBuffer<uint8_t>(gather<uint8_t>(m_bool, indices)); break;
+        case DType::String:
+            column.m_strings = ValueBuffer<std::string_view>(gather<std::string_view>(m_strings, indices));
+            column.m_storage = m_storage;
+            break;
+        case DType::Category:
+            column.m_strings = m_strings;
+            column.m_storage = m_storage;
+            switch (categoryCodeWidth(m_strings.size())) {
+                case 1:  column.m_codes8 = ValueBuffer<uint8_t>(gather<uint8_t>(m_codes8, indices)); break;
+                case 2:  column.m_codes16 = ValueBuffer<uint16_t>(gather<uint16_t>(m_codes16, indices)); break;
+                default: column.m_codes32 = ValueBuffer<uint32_t>(gather<uint32_t>(m_codes32, indices)); break;
+            }
+            break;
+    }
+    column.buildValidity();
+    return column;
+}
+
+size_t ColumnBuffer::size() const {
+    switch (m_dtype) {
+        case DType::Float64: return m_float64.size();
+        case DType::Int64:   return m_int64.size();
+        case DType::Bool:    return m_bool.size();
+        case DType::Datetime: return m_int64.size();
+        case DType::String:  return m_strings.size();
+        case DType::Category:
+            return visitCodes([](auto codes) { return codes.size(); }, size_t(0));
+    }
+    return 0;
+}
+
+size_t ColumnBuffer::memoryUsage() const {
+    size_t bytes = m_validity->words().size_bytes();
+    switch (m_dtype) {
+        case DType::Float64: return bytes + m_float64.size() * sizeof(double);
+        case DType::Int64:
+        case DType::Datetime: return bytes + m_int64.size() * sizeof(int64_t);
+        case DType::Bool:    return bytes + m_bool.size();
+        case DType::String:
+        case DType::Category:
+            break;
+    }
+    bytes += m_strings.size() * sizeof(std::string_view);
+    for (std::string_view value : m_strings) {
+        bytes += value.size();
+    }
+    return bytes + visitCodes([](auto codes) { return codes.size_bytes(); }, size_t(0));
+}
+
+bool ColumnBuffer::isNull(size_t index) const {
+    return !m_validity->test(index);
+}
+
+namespace {
+
+// Monta o mapa de validade uma palavra (64 valores) por vez
+template <typename T, typename IsValid>
+void fillValidity(std::span<const T> values, Bitmap& validity, IsValid isValid) {
+    for (size_t w = 0; w < Bitmap::wordCount(values.size()); ++w) {
+        size_t begin = w * 64;
+        size_t end = std::min(begin + 64, values.size());
+        uint64_t word = 0;
+        for (size_t i = begin; i < end; ++i) {
+            word |= uint64_t(isValid(values[i])) << (i - begin);
+        }
+        validity.setWord(w, word);
+    }
+}
+
+} // namespace
+
+void ColumnBuffer::buildValidity() {
+    size_t count = size();
+    Bitmap validity(count, true);
+
+    // int64 e bool não representam nulos
+    switch (m_dtype) {
+        case DType::Float64:
+            fillValidity<double>(m_float64, validity, [](double value) { return !std::isnan(value); });
+            break;
+        case DType::Datetime:
+            fillValidity<int64_t>(m_int64, validity, [](int64_t value) { return value != kNaT; });
+            break;
+        case DType::String:
+            fillValidity<std::string_view>(m_strings, validity, [](std::string_view value) { return !value.empty(); });
+            break;
+        case DType::Category:
+            visitCodes([&validity](auto codes) {
+                using Code = typename decltype(codes)::value_type;
+                fillValidity<Code>(codes, validity, [](Code code) { return code != std::numeric_limits<Code>::max(); });
+                return 0;
+            }, 0);
+            break;
+        default:
+            break;
+    }
+    m_nullCount = count - validity.count();
+    m_validity = std::make_shared<const Bitmap>(std::move(validity));
+    m_sortCache = isNumeric() ? std::make_shared<SortCache>() : nullptr;
+}
+
+ColumnBuffer ColumnBuffer::fromExternal(DType dtype, const void* values, size_t size, Bitmap validity,
+                                        std::shared_ptr<const void> owner) {
+    if (validity.size() != size) {
+        throw std::invalid_argument("Validity bitmap size does not match column size");
+    }
+
+    ColumnBuffer column;
+    column.m_dtype = dtype;
+    switch (dtype) {
+        case DType::Float64:
+            column.m_float64 = ValueBuffer<double>(static_cast<const double*>(values), size, std::move(owner));
+            break;
+        case DType::Int64:
+        case DType::Datetime:
+            column.m_int64 = ValueBuffer<int64_t>(static_cast<const int64_t*>(values), size, std::move(owner));
+            break;
+        case DType::Bool:
+            column.m_bool = ValueBuffer<uint8_t>(static_cast<const uint8_t*>(values), size, std::move(owner));
+            break;
+        case DType::String:
+        case DType::Category:
+            throw std::invalid_argument("String columns cannot reference external values");
+    }
+
+    // O mapa de validade vem pronto, sem percorrer os valores
+    column.m_nullCount = size - validity.count();
+    column.m_validity = std::make_shared<const Bitmap>(std::move(validity));
+    column.m_sortCache = std::make_shared<SortCache>();
+    return column;
+}
+
+std::span<const double> ColumnBuffer::float64() const {
+    if (m_dtype != DType::Float64) {
+        throw std::logic_error("Column is not float64");
+    }
+    return m_float64;
+}
+
+std::span<const int64_t> ColumnBuffer::int64() const {
+    if (m_dtype != DType::Int64) {
+        throw std::logic_error("Column is not int64");
+    }
+    return m_int64;
+}
+
+std::span<const uint8_t> ColumnBuffer::boolean() const {
+    if (m_dtype != DType::Bool) {
+        throw std::logic_error("Column is not bool");
+    }
+    return m_bool;
+}
+
+std::span<const int64_t> ColumnBuffer::datetime() const {
+    if (m_dtype != DType::Datetime) {
+        throw std::logic_error("Column is not datetime");
+    }
+    return m_int64;
+}
+
+std::span<const std::string_view> ColumnBuffer::strings() const {
+    if (m_dtype != DType::String) {
+        throw std::logic_error("Column is not string");
+    }
+    return m_strings;
+}
+
+std::span<const std::string_view> ColumnBuffer::categories() const {
+    if (m_dtype != DType::Category) {
+        throw std::logic_error("Column is not category");
+    }
+    return m_strings;
+}
+
+uint32_t ColumnBuffer::code(size_t index) const {
+    return visitCodes([index](auto codes) -> uint32_t {
+        auto value = codes[index];
+        return value == std::numeric_limits<decltype(value)>::max() ? kNullCode : value;
+    }, kNullCode);
+}
+
+uint32_t ColumnBuffer::findCategory(std::string_view value) const {
+    auto categories = this->categories();
+    auto found = std::find(categories.begin(), categories.end(), value);
+    return found == categories.end() ? kNullCode : static_cast<uint32_t>(found - categories.begin());
+}
+
+Bitmap ColumnBuffer::equalTo(std::string_view value) const {
+    Bitmap result(size(), false);
+    if (value.empty()) {
+        return result;
+    }
+
+    switch (m_dtype) {
+        case DType::Category: {
+            uint32_t target = findCategory(value);
+            if (target == kNullCode) {
+                return result;
+            }
+            visitCodes([&result, target](auto codes) {
+                using Code = typename decltype(codes)::value_type;
+                fillValidity<Code>(codes, result, [target](Code code) { return code == target; });
+                return 0;
+            }, 0);
+            break;
+        }
+        case DType::String:
+            fillValidity<std::string_view>(m_strings, result, [value](std::string_view cell) { return cell == value; });
+            break;
+        default:
+            for (size_t i = 0; i < result.size(); ++i) {
+                if (!isNull(i) && getString(i) == value) {
+                    result.set(i);
+                }
+            }
+            break;
+    }
+    return result;
+}
+
+Bitmap ColumnBuffer::compare(CompareOp op, double value) const {
+    if (!isNumeric()) {
+        throw std::invalid_argument(std::string("Cannot compare ") + dtypeName(m_dtype) + " column with a number");
+    }
+    return visitNumeric([op, value](auto values) { return CPPandas::compare(values, op, value); }, Bitmap());
+}
+
+Bitmap ColumnBuffer::between(double low, double high) const {
+    if (!isNumeric()) {
+        throw std::invalid_argument(std::string("Cannot compare ") + dtypeName(m_dtype) + " column with a number");
+    }
+    return visitNumeric([low, high](auto values) { return CPPandas::between(values, low, high); }, Bitmap());
+}
+
+Bitmap ColumnBuffer::isin(std::span<const double> values) const {
+    if (!isNumeric()) {
+        throw std::invalid_argument(std::string("Cannot compare ") + dtypeName(m_dtype) + " column with a number");
+    }
+    std::vector<double> wanted;
+    for (double value : values) {
+        if (!std::isnan(value)) {
+            wanted.push_back(value);
+        }
+    }
+    std::sort(wanted.begin(), wanted.end());
+    wanted.erase(std::unique(wanted.begin(), wanted.end()), wanted.end());
+
+    // Poucos valores: uma comparação vetorizada por valor; senão, busca binária por linha
+    constexpr size_t kMaxScans = 4;
+    Bitmap result(size(), false);
+    if (wanted.size() <= kMaxScans) {
+        for (double value : wanted) {
+            result |= compare(CompareOp::Equal, value);
+        }
+        return result;
+    }
+    visitNumeric([&result, &wanted](auto data) {
+        using T = typename decltype(data)::value_type;
+        if constexpr (std::is_floating_point_v<T>) {
+            fillValidity<T>(data, result, [&wanted](T value) {
+                return !std::isnan(value) && std::binary_search(wanted.begin(), wanted.end(), value);
+            });
+        } else {
+            // Colunas inteiras são comparadas sem conversão para double, que
+            // confundiria valores distintos acima de 2^53: só os números
+            // inteiros representáveis em int64 podem ser encontrados
+            constexpr double kInt64Limit = 9223372036854775808.0;  // 2^63
+            std::vector<int64_t> integers;
+            for (double value : wanted) {
+                if (value == std::floor(value) && value >= -kInt64Limit && value < kInt64Limit) {
+                    integers.push_back(static_cast<int64_t>(value));
+                }
+            }
+            fillValidity<T>(data, result, [&integers](T value) {
+                return std::binary_search(integers.begin(), integers.end(), static_cast<int64_t>(value));
+            });
+        }
+        return 0;
+    }, 0);
+    return result;
+}
+
+Bitmap ColumnBuffer::isin(std::span<const std::string_view> values) const {
+    Bitmap result(size(), false);
+    std::unordered_set<std::string_view> wanted(values.begin(), values.end());
+    wanted.erase(std::string_view());
+
+    switch (m_dtype) {
+        case DType::Category: {
+            // Uma consulta por categoria; as linhas são marcadas pelos códigos
+            auto categories = this->categories();
+            std::vector<uint8_t> selected(categories.size(), 0);
+            for (size_t i = 0; i < categories.size(); ++i) {
+                selected[i] = wanted.count(categories[i]) > 0;
+            }
+            visitCodes([&result, &selected](auto codes) {
+                using Code = typename decltype(codes)::value_type;
+                fillValidity<Code>(codes, result, [&selected](Code code) {
+                    return code != std::numeric_limits<Code>::max() && selected[code];
+                });
+                return 0;
+            }, 0);
+            break;
+        }
+        case DType::String:
+            fillValidity<std::string_view>(m_strings, result, [&wanted](std::string_view cell) {
+                return !cell.empty() && wanted.count(cell) > 0;
+            });
+            break;
+        default:
+            for (std::string_view value : wanted) {
+                result |= equalTo(value);
+            }
+            break;
+    }
+    return result;
+}
+
+double ColumnBuffer::getDouble(size_t index) const {
+    switch (m_dtype) {
+        case DType::Float64: return m_float64[index];
+        case DType::Int64:   return static_cast<double>(m_int64[index]);
+        case DType::Bool:    return m_bool[index];
+        default:             return std::numeric_limits<double>::quiet_NaN();
+    }
+}
+
+NumericBuffer ColumnBuffer::toNumeric() const {
+    if (m_dtype == DType::String) {
+        return CPPandas::toNumeric(std::span<const std::string_view>(m_strings));
+    }
+    if (m_dtype == DType::Category) {
+        std::vector<std::string_view> cells = decodeCategories();
+        return CPPandas::toNumeric(std::span<const std::string_view>(cells));
+    }
+
+    NumericBuffer buffer;
+    size_t count = size();
+    buffer.values.resize(count);
+    buffer.valid.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        double value = getDouble(i);
+        bool ok = !std::isnan(value);
+        buffer.values[i] = value;
+        buffer.valid[i] = ok;
+        buffer.validCount += ok;
+    }
+    buffer.emptyCount = count - buffer.validCount;
+    return buffer;
+}
+
+std::string ColumnBuffer::getString(size_t index) const {
+    char buffer[32];
+    switch (m_dtype) {
+        case DType::Float64: {
+            double value = m_float64[index];
+            if (std::isnan(value)) {
+                return std::string();
+            }
+            // Representação mais curta que preserva o valor (ida e volta exata)
+            return std::string(buffer, formatFloat64(value, buffer));
+        }
+        case DType::Int64: {
+            auto result = std::to_chars(buffer, buffer + sizeof(buffer), m_int64[index]);
+            return std::string(buffer, result.ptr);
+        }
+        case DType::Bool:
+            return m_bool[index] ? "True" : "False";
+        case DType::Datetime:
+            return m_int64[index] == kNaT ? std::string() : formatDatetime(m_int64[index]);
+        case DType::String:
+            return std::string(m_strings[index]);
+        case DType::Category: {
+            uint32_t category = code(index);
+            return category == kNullCode ? std::string() : std::string(m_strings[category]);
+        }
+    }
+    return std::string();
+}
+
+std::vector<double> ColumnBuffer::validValues() const {
+    return visitNumeric([](auto values) {
+        std::vector<double> valid;
+        valid.reserve(values.size());
+        for (auto raw : values) {
+            double value = static_cast<double>(raw);
+            if (!std::isnan(value)) {
+                valid.push_back(value);
+            }
+        }
+        return valid;
+    }, std::vector<double>());
+}
+
+std::vector<double> ColumnBuffer::quantiles(std::span<const double> qs) const {
+    // Uma consulta isolada não paga a ordenação completa
+    if (!m_sortCache || m_sortCache->queries.fetch_add(1) == 0) {
+        std::vector<double> values = validValues();
+        return selectQuantiles(values, qs);
+    }
+
+    std::call_once(m_sortCache->sortOnce, [this]() {
+        std::vector<double> sorted = validValues();
+        std::sort(sorted.begin(), sorted.end());
+        m_sortCache->sorted = std::move(sorted);
+    });
+    return sortedQuantiles(m_sortCache->sorted, qs);
+}
+
+} // namespace CPPandas
@@ -0,0 +1,283 @@
+/**
+ * @file compare.cpp
+ * @brief Kernels de comparação (escalar, AVX2 e AVX-512) que escrevem máscaras de 64 linhas por palavra
+ */
+
+#include "cppandas/compare.hpp"
+#include "simd.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace CPPandas {
+
+namespace {
+
+constexpr double kInfinity = std::numeric_limits<double>::infinity();
+constexpr double kInt64Limit = 9223372036854775808.0;  // 2^63
+
+detail::SimdLevel compareSimdLevel() {
+    static const detail::SimdLevel level = detail::detectSimdLevel();
+    return level;
+}
+
+// Bits de até 64 valores consecutivos (bit j = values[j] em [low, high])
+template <typename T>
+uint64_t rangeWordScalar(const T* values, size_t count, T low, T high) {
+    uint64_t bits = 0;
+    for (size_t j = 0; j < count; ++j) {
+        bits |= static_cast<uint64_t>(values[j] >= low && values[j] <= high) << j;
+    }
+    return bits;
+}
+
+template <typename T>
+void rangeScalar(const T* values, size_t size, T low, T high, Bitmap& out) {
+    for (size_t w = 0; w * 64 < size; ++w) {
+        out.setWord(w, rangeWordScalar(values + w * 64, std::min<size_t>(64, size - w * 64), low, high));
+    }
+}
+
+#if defined(CPPANDAS_X86)
+CPPANDAS_TARGET("avx2")
+void rangeAVX2(const double* values, size_t size, double low, double high, Bitmap& out) {
+    const __m256d lowVector = _mm256_set1_pd(low);
+    const __m256d highVector = _mm256_set1_pd(high);
+    size_t w = 0;
+    for (; (w + 1) * 64 <= size; ++w) {
+        const double* block = values + w * 64;
+        uint64_t bits = 0;
+        for (size_t j = 0; j < 16; ++j) {
+            __m256d x = _mm256_loadu_pd(block + j * 4);
+            __m256d inside = _mm256_and_pd(_mm256_cmp_pd(x, lowVector, _CMP_GE_OQ),
+                                           _mm256_cmp_pd(x, highVector, _CMP_LE_OQ));
+            bits |= static_cast<uint64_t>(_mm256_movemask_pd(inside)) << (j * 4);
+        }
+        out.setWord(w, bits);
+    }
+    if (w * 64 < size) {
+        out.setWord(w, rangeWordScalar(values + w * 64, size - w * 64, low, high));
+    }
+}
+
+CPPANDAS_TARGET("avx2")
+void rangeAVX2(const int64_t* values, size_t size, int64_t low, int64_t high, Bitmap& out) {
+    const __m256i lowVector = _mm256_set1_epi64x(low);
+    const __m256i highVector = _mm256_set1_epi64x(high);
+    size_t w = 0;
+    for (; (w + 1) * 64 <= size; ++w) {
+        const int64_t* block = values + w * 64;
+        uint64_t outside = 0;
+        for (size_t j = 0; j < 16; ++j) {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + j * 4));
+            __m256i rejected = _mm256_or_si256(_mm256_cmpgt_epi64(lowVector, x), _mm256_cmpgt_epi64(x, highVector));
+            outside |= static_cast<uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(rejected))) << (j * 4);
+        }
+        out.setWord(w, ~outside);
+    }
+    if (w * 64 < size) {
+        out.setWord(w, rangeWordScalar(values + w * 64, size - w * 64, low, high));
+    }
+}
+
+CPPANDAS_TARGET("avx512f")
+void rangeAVX512(const double* values, size_t size, double low, double high, Bitmap& out) {
+    const __m512d lowVector = _mm512_set1_pd(low);
+    const __m512d highVector = _mm512_set1_pd(high);
+    size_t w = 0;
+    for (; (w + 1) * 64 <= size; ++w) {
+        const double* block = values + w * 64;
+        uint64_t bits = 0;
+        for (size_t j = 0; j < 8; ++j) {
+            __m512d x = _mm512_loadu_pd(block + j * 8);
+            __mmask8 inside = _mm512_mask_cmp_pd_mask(_mm512_cmp_pd_mask(x, lowVector, _CMP_GE_OQ),
+                                                      x, highVector, _CMP_LE_OQ);
+            bits |= static_cast<uint64_t>(inside) << (j * 8);
+        }
+        out.setWord(w, bits);
+    }
+    if (w * 64 < size) {
+        out.setWord(w, rangeWordScalar(values + w * 64, size - w * 64, low, high));
+    }
+}
+
+CPPANDAS_TARGET("avx512f")
+void rangeAVX512(const int64_t* values, size_t size, int64_t low, int64_t high, Bitmap& out) {
+    const __m512i lowVector = _mm512_set1_epi64(low);
+    const __m512i highVector = _mm512_set1_epi64(high);
+    size_t w = 0;
+    for (; (w + 1) * 64 <= size; ++w) {
+        const int64_t* block = values + w * 64;
+        uint64_t bits = 0;
+        for (size_t j = 0; j < 8; ++j) {
+            __m512i x = _mm512_loadu_si512(block + j * 8);
+            __mmask8 inside = _mm512_mask_cmp_epi64_mask(_mm512_cmp_epi64_mask(x, lowVector, _MM_CMPINT_NLT),
+                                                         x, highVector, _MM_CMPINT_LE);
+            bits |= static_cast<uint64_t>(inside) << (j * 8);
+        }
+        out.setWord(w, bits);
+    }
+    if (w * 64 < size) {
+        out.setWord(w, rangeWordScalar(values + w * 64, size - w * 64, low, high));
+    }
+}
+#endif
+
+template <typename T>
+Bitmap rangeMask(std::span<const T> values, T low, T high) {
+    Bitmap result(values.size(), false);
+#if defined(CPPANDAS_X86)
+    switch (compareSimdLevel()) {
+        case detail::SimdLevel::AVX512:
+            rangeAVX512(values.data(), values.size(), low, high, result);
+            return result;
+        case detail::SimdLevel::AVX2:
+            rangeAVX2(values.data(), values.size(), low, high, result);
+            return result;
+        default:
+            break;
+    }
+#endif
+    rangeScalar(values.data(), values.size(), low, high, result);
+    return result;
+}
+
+// Intervalo inteiro [first, last] equivalente a uma comparação com um valor real
+struct IntegerRange {
+    int64_t first = std::numeric_limits<int64_t>::min();
+    int64_t last = std::numeric_limits<int64_t>::max();
+    bool empty = false;
+
+    void intersect(const IntegerRange& other) {
+        first = std::max(first, other.first);
+        last = std::min(last, other.last);
+        empty = empty || other.empty || first > last;
+    }
+};
+
+int64_t saturate(double integral) {
+    if (integral < -kInt64Limit) {
+        return std::numeric_limits<int64_t>::min();
+    }
+    if (integral >= kInt64Limit) {
+        return std::numeric_limits<int64_t>::max();
+    }
+    return static_cast<int64_t>(integral);
+}
+
+IntegerRange integerRange(CompareOp op, double value) {
+    IntegerRange range;
+    if (std::isnan(value)) {
+        range.empty = true;
+        return range;
+    }
+    switch (op) {
+        case CompareOp::Equal:
+        case CompareOp::NotEqual:
+            range.empty = value != std::floor(value) || value < -kInt64Limit || value >= kInt64Limit;
+            range.first = range.last = range.empty ? 0 : static_cast<int64_t>(value);
+            break;
+        case CompareOp::GreaterEqual:
+            range.empty = std::ceil(value) >= kInt64Limit;
+            range.first = saturate(std::ceil(value));
+            break;
+        case CompareOp::Greater:
+            // floor(value) < 2^63 implica floor(value) <= 2^63 - 1024: first + 1 não transborda
+            range.empty = std::floor(value) >= kInt64Limit;
+            if (!range.empty && std::floor(value) >= -kInt64Limit) {
+                range.first = saturate(std::floor(value)) + 1;
+            }
+            break;
+        case CompareOp::LessEqual:
+            range.empty = std::floor(value) < -kInt64Limit;
+            range.last = saturate(std::floor(value));
+            break;
+        case CompareOp::Less:
+            range.empty = std::ceil(value) <= -kInt64Limit;
+            range.last = std::ceil(value) >= kInt64Limit ? range.last : saturate(std::ceil(value)) - 1;
+            break;
+    }
+    return range;
+}
+
+// Valores inteiros (int64 ou bool) em um intervalo, com NotEqual como complemento de Equal
+template <typename T>
+Bitmap compareIntegers(std::span<const T> values, CompareOp op, const IntegerRange& range) {
+    Bitmap result(values.size(), false);
+    if (!range.empty) {
+        if constexpr (std::is_same_v<T, int64_t>) {
+            result = rangeMask<int64_t>(values, range.first, range.last);
+        } else {
+            // Booleanos valem 0 ou 1
+            const int64_t first = std::max<int64_t>(range.first, 0);
+            const int64_t last = std::min<int64_t>(range.last, 1);
+            if (first <= last) {
+                rangeScalar(values.data(), values.size(), static_cast<T>(first), static_cast<T>(last), result);
+            }
+        }
+    }
+    return op == CompareOp::NotEqual ? ~std::move(result) : result;
+}
+
+} // namespace
+
+Bitmap inRange(std::span<const double> values, double low, double high) {
+    return rangeMask<double>(values, low, high);
+}
+
+Bitmap inRange(std::span<const int64_t> values, int64_t low, int64_t high) {
+    return rangeMask<int64_t>(values, low, high);
+}
+
+Bitmap compare(std::span<const double> values, CompareOp op, double value) {
+    if (std::isnan(value)) {
+        return Bitmap(values.size(), op == CompareOp::NotEqual);
+    }
+    switch (op) {
+        case CompareOp::Equal:
+            return inRange(values, value, value);
+        case CompareOp::NotEqual:
+            return ~inRange(values, value, value);
+        case CompareOp::Less:
+            return value == -kInfinity ? Bitmap(values.size(), false)
+                                       : inRange(values, -kInfinity, std::nextafter(value, -kInfinity));
+        case CompareOp::LessEqual:
+            return inRange(values, -kInfinity, value);
+        case CompareOp::Greater:
+            return value == kInfinity ? Bitmap(values.size(), false)
+                                      : inRange(values, std::nextafter(value, kInfinity), kInfinity);
+        case CompareOp::GreaterEqual:
+            return inRange(values, value, kInfinity);
+    }
+    return Bitmap(values.size(), false);
+}
+
+Bitmap compare(std::span<const int64_t> values, CompareOp op, double value) {
+    return compareIntegers(values, op, integerRange(op, value));
+}
+
+Bitmap compare(std::span<const uint8_t> values, CompareOp op, double value) {
+    return compareIntegers(values, op, integerRange(op, value));
+}
+
+Bitmap between(std::span<const double> values, double low, double high) {
+    if (std::isnan(low) || std::isnan(high)) {
+        return Bitmap(values.size(), false);
+    }
+    return inRange(values, low, high);
+}
+
+Bitmap between(std::span<const int64_t> values, double low, double high) {
+    IntegerRange range = integerRange(CompareOp::GreaterEqual, low);
+    range.intersect(integerRange(CompareOp::LessEqual, high));
+    return compareIntegers(values, CompareOp::Equal, range);
+}
+
+Bitmap between(std::span<const uint8_t> values, double low, double high) {
+    IntegerRange range = integerRange(CompareOp::GreaterEqual, low);
+    range.intersect(integerRange(CompareOp::LessEqual, high));
+    return compareIntegers(values, CompareOp::Equal, range);
+}
+
+} // namespace CPPandas
@@ -1,123 +1,532 @@
 /**
  * @file csv.cpp
- * @brief Implementação de alta performance da classe CSV sem dependências de threading
+ * @brief Implementação de alta performance da classe CSV
  */
 
  #include "cppandas/csv.hpp"
+ #include "cppandas/mapped_file.hpp"
+ #include "cppandas/thread_pool.hpp"
+ #include "string_arena.hpp"
+ #include "tokenizer.hpp"
  #include <fstream>
  #include <stdexcept>
  #include <algorithm>
+ #include <array>
  #include <memory>
+ #include <mutex>
  #include <vector>
  #include <cstring>
  #include <sstream>
  
  namespace CPPandas {
  
- CSV::CSV() : m_hasHeader(false), m_delimiter(',') {}
+ CSV::CSV() : m_rowCount(0), m_hasHeader(false), m_delimiter(',') {}
  
  CSV::CSV(const std::string& filename, bool hasHeader, char delimiter) 
-     : m_hasHeader(hasHeader), m_delimiter(delimiter) {
+     : m_rowCount(0), m_hasHeader(hasHeader), m_delimiter(delimiter) {
      load(filename, hasHeader, delimiter);
  }
  
+ CSV::CSV(const std::string& filename, const ReadOptions& options)
+     : m_rowCount(0), m_hasHeader(options.hasHeader), m_delimiter(options.delimiter) {
+     load(filename, options);
+ }
+ 
  CSV::~CSV() {}
  
  bool CSV::load(const std::string& filename, bool hasHeader, char delimiter) {
-     // Usar técnica de buffer otimizado para leitura mais rápida
-     std::ifstream file(filename, std::ios::binary | std::ios::ate);
-     if (!file.is_open()) {
-         return false;
+     ReadOptions options;
+     options.hasHeader = hasHeader;
+     options.delimiter = delimiter;
+     return load(filename, options);
+ }
+ 
+ bool CSV::load(const std::string& filename, const ReadOptions& options) {
+     // Modo mapeado: os campos de texto referenciam o mapeamento sem cópias.
+     // Com nrows, o mapeamento também evita ler o arquivo inteiro: só as
+     // páginas até a última linha pedida são lidas do disco
+     std::shared_ptr<const MappedFile> mapped;
+     std::unique_ptr<char[]> buffer;
+     std::streamsize fileSize = 0;
+ 
+     if (options.memoryMap || options.nrows > 0) {
+         mapped = MappedFile::open(filename);
+         if (!mapped && options.memoryMap) {
+             return false;
+         }
+     }
+     if (!mapped) {
+         // Usar técnica de buffer otimizado para leitura mais rápida
+         std::ifstream file(filename, std::ios::binary | std::ios::ate);
+         if (!file.is_open()) {
+             return false;
+         }
+ 
+         // Determinar tamanho do arquivo e reservar memória
+         fileSize = file.tellg();
+         file.seekg(0, std::ios::beg);
+ 
+         // Alocar buffer de memória
+         buffer.reset(new char[fileSize + 1]);
+         
+         // Ler o arquivo inteiro de uma vez
+         if (!file.read(buffer.get(), fileSize)) {
+             return false;
+         }
+         buffer[fileSize] = '\0'; // Garantir terminação apropriada
      }
  
      // Configurar atributos da classe
-     m_hasHeader = hasHeader;
-     m_delimiter = delimiter;
-     m_data.clear();
+     m_hasHeader = options.hasHeader;
+     m_delimiter = options.delimiter;
+     m_columns.clear();
+     m_rowCount = 0;
+     m_rowCache = std::make_shared<RowCache>();
      m_headers.clear();
      m_headerMap.clear();
+     m_schema = Schema();
  
-     // Determinar tamanho do arquivo e reservar memória
-     std::streamsize fileSize = file.tellg();
-     file.seekg(0, std::ios::beg);
+     if (mapped) {
+         // Sem memoryMap, o texto é copiado e o mapeamento termina com a leitura
+         std::shared_ptr<const void> owner;
+         if (options.memoryMap) {
+             owner = mapped;
+         }
+         parseBuffer(mapped->data(), mapped->data() + mapped->size(), std::move(owner), options);
+     } else {
+         // O buffer é descartado ao fim da leitura, então o texto é copiado
+         parseBuffer(buffer.get(), buffer.get() + fileSize, nullptr, options);
+     }
  
-     // Alocar buffer de memória
-     std::unique_ptr<char[]> buffer(new char[fileSize + 1]);
-     
-     // Ler o arquivo inteiro de uma vez
-     if (!file.read(buffer.get(), fileSize)) {
-         return false;
+     return true;
+ }
+ 
+ CSV CSV::fromColumns(VectorStr headers, std::vector<ColumnBuffer> columns) {
+     if (headers.size() != columns.size()) {
+         throw std::invalid_argument("Number of headers does not match number of columns");
+     }
+     size_t rowCount = columns.empty() ? 0 : columns.front().size();
+     for (const auto& column : columns) {
+         if (column.size() != rowCount) {
+             throw std::invalid_argument("All columns must have the same length");
+         }
+     }
+ 
+     CSV csv;
+     csv.m_hasHeader = true;
+     csv.m_rowCount = rowCount;
+     csv.m_columns = std::move(columns);
+     csv.setHeaders(std::move(headers));
+     csv.updateSchema(csv.m_headers);
+     return csv;
+ }
+ 
+ CSV CSV::fromRows(VectorStr headers, const DataFrame& rows) {
+     std::vector<std::vector<std::string>> cells(headers.size());
+     for (auto& column : cells) {
+         column.reserve(rows.size());
+     }
+     for (const auto& row : rows) {
+         for (size_t col = 0; col < cells.size(); ++col) {
+             cells[col].push_back(col < row.size() ? row[col] : std::string());
+         }
+     }
+ 
+     std::vector<ColumnBuffer> columns;
+     columns.reserve(cells.size());
+     for (auto& column : cells) {
+         columns.push_back(ColumnBuffer::fromStrings(std::move(column)));
+     }
+ 
+     CSV csv = fromColumns(std::move(headers), std::move(columns));
+     csv.m_rowCount = rows.size();
+     return csv;
+ }
+ 
+ CSV CSV::take(std::span<const size_t> rowIndices) const {
+     std::vector<ColumnBuffer> columns;
+     columns.reserve(m_columns.size());
+     for (const auto& column : m_columns) {
+         columns.push_back(column.take(rowIndices));
+     }
+ 
+     CSV csv;
+     csv.m_hasHeader = m_hasHeader;
+     csv.m_delimiter = m_delimiter;
+     csv.m_rowCount = rowIndices.size();
+     csv.m_columns = std::move(columns);
+     csv.setHeaders(m_headers);
+     csv.m_schema = m_schema;
+     return csv;
+ }
+ 
+ namespace {
+ 
+ // Abaixo deste tamanho, o custo de criar threads supera o ganho
+ constexpr size_t kParallelMinBytes = 1 << 20;
+ 
+ // Marca, em CSV::parseRows, os campos de colunas não selecionadas
+ constexpr size_t kSkippedField = static_cast<size_t>(-1);
+ 
+ // Texto de origem dos campos mais os campos que precisaram de unescape;
+ // mantido vivo pelas colunas de texto carregadas sem cópia
+ struct ParsedText {
+     std::shared_ptr<const void> source;
+     std::vector<detail::StringArena> unescaped;  ///< Um por bloco
+ };
+ 
+ // Avança até o início da próxima linha que não está dentro de aspas, a
+ // partir do estado de aspas em current
+ const char* skipLine(const char* current, const char* end, char delimiter, detail::ScanState state) {
+     static const detail::SimdLevel level = detail::scannerSimdLevel();
+     std::vector<uint32_t> positions;
+     for (const char* window = current; window < end; window += detail::kScanWindow) {
+         uint32_t length = static_cast<uint32_t>(std::min<size_t>(detail::kScanWindow, end - window));
+         positions.resize(static_cast<size_t>(length) + 64);
+         size_t count = detail::scanFieldBoundaries(window, length, delimiter, state, positions.data(), level);
+         for (size_t k = 0; k < count; ++k) {
+             const char* position = window + positions[k];
+             if (*position != delimiter) {
+                 if (*position == '\r' && position + 1 < end && position[1] == '\n') {
+                     return position + 2;
+                 }
+                 return position + 1;
+             }
+         }
+     }
+     return end;
+ }
+ 
+ // Avança após count linhas não vazias (campos entre aspas podem conter quebras de linha)
+ const char* skipRecords(const char* begin, const char* end, char delimiter, size_t count) {
+     if (count == 0) {
+         return begin;
+     }
+     size_t rows = 0;
+     return detail::tokenize(begin, end, delimiter,
+         [](std::string_view, bool) {},
+         [&rows, count]() { return ++rows < count; });
+ }
+ 
+ // Coluna de destino de cada campo da linha (kSkippedField para colunas não selecionadas)
+ std::vector<size_t> fieldSlotsFor(const std::vector<size_t>& sourceColumns) {
+     std::vector<size_t> fieldSlots;
+     if (!sourceColumns.empty()) {
+         fieldSlots.assign(sourceColumns.back() + 1, kSkippedField);
+         for (size_t col = 0; col < sourceColumns.size(); ++col) {
+             fieldSlots[sourceColumns[col]] = col;
+         }
+     }
+     return fieldSlots;
+ }
+ 
+ // Posição no arquivo de cada coluna selecionada por ReadOptions::usecols,
+ // na ordem do arquivo (como no pandas)
+ std::vector<size_t> selectColumns(const VectorStr& headers, size_t columnCount, const ReadOptions& options) {
+     std::vector<size_t> columns;
+     if (options.usecols.empty() && options.usecolIndices.empty()) {
+         columns.resize(columnCount);
+         for (size_t i = 0; i < columnCount; ++i) {
+             columns[i] = i;
+         }
+         return columns;
+     }
+ 
+     std::vector<bool> selected(columnCount, false);
+     for (const auto& name : options.usecols) {
+         auto it = std::find(headers.begin(), headers.end(), name);
+         if (it == headers.end()) {
+             throw std::invalid_argument("usecols: column not found: " + name);
+         }
+         selected[static_cast<size_t>(it - headers.begin())] = true;
+     }
+     for (size_t index : options.usecolIndices) {
+         if (index >= columnCount) {
+             throw std::invalid_argument("usecols: column index out of range: " + std::to_string(index));
+         }
+         selected[index] = true;
      }
-     buffer[fileSize] = '\0'; // Garantir terminação apropriada
  
-     // Reservar capacidade estimada para reduzir realocações
-     size_t estimatedLines = std::count(buffer.get(), buffer.get() + fileSize, '\n') + 1;
-     m_data.reserve(estimatedLines);
+     for (size_t i = 0; i < columnCount; ++i) {
+         if (selected[i]) {
+             columns.push_back(i);
+         }
+     }
+     return columns;
+ }
  
-     // Processar o buffer de forma eficiente
-     char* lineStart = buffer.get();
-     char* current = buffer.get();
-     char* end = buffer.get() + fileSize;
+ } // namespace
+ 
+ void CSV::parseBuffer(const char* begin, const char* end, std::shared_ptr<const void> owner,
+                       const ReadOptions& options) {
+     // Arquivo vazio (mapeado, begin pode ser nulo): nenhuma coluna
+     if (begin == end) {
+         return;
+     }
+ 
+     // Linhas iniciais ignoradas (antes do cabeçalho, como no pandas)
+     const char* dataStart = skipRecords(begin, end, m_delimiter, options.skiprows);
  
      // Ler cabeçalho se existir
+     VectorStr headers;
      if (m_hasHeader) {
-         // Encontrar final da primeira linha
-         while (current < end && *current != '\n' && *current != '\r') {
-             current++;
+         dataStart = detail::tokenize(dataStart, end, m_delimiter,
+             [&headers](std::string_view field, bool escaped) {
+                 headers.push_back(escaped ? detail::unescapeQuotes(field) : std::string(field));
+             },
+             []() { return false; });
+     }
+ 
+     // Sem cabeçalho, a primeira linha não vazia define o número de colunas
+     size_t columnCount = headers.size();
+     if (!m_hasHeader) {
+         detail::tokenize(dataStart, end, m_delimiter,
+             [&columnCount](std::string_view, bool) { columnCount++; },
+             []() { return false; });
+     }
+ 
+     std::vector<size_t> sourceColumns = selectColumns(headers, columnCount, options);
+     if (m_hasHeader) {
+         VectorStr selected;
+         selected.reserve(sourceColumns.size());
+         for (size_t source : sourceColumns) {
+             selected.push_back(std::move(headers[source]));
          }
-         
-         // Processar cabeçalho
-         std::string headerLine(lineStart, current - lineStart);
-         m_headers = parseLine(headerLine, m_delimiter);
-         
-         // Criar mapeamento de nomes para índices
-         m_headerMap.reserve(m_headers.size()); // Pré-alocar para evitar rehashing
-         for (size_t i = 0; i < m_headers.size(); ++i) {
-             m_headerMap[m_headers[i]] = i;
+         setHeaders(std::move(selected));
+     }
+ 
+     parseData(dataStart, end, std::move(owner), options, sourceColumns);
+ }
+ 
+ void CSV::setHeaders(VectorStr headers) {
+     m_headers = std::move(headers);
+     
+     // Criar mapeamento de nomes para índices
+     m_headerMap.clear();
+     m_headerMap.reserve(m_headers.size()); // Pré-alocar para evitar rehashing
+     for (size_t i = 0; i < m_headers.size(); ++i) {
+         m_headerMap[m_headers[i]] = i;
+     }
+ }
+ 
+ VectorStr CSV::columnNames(const std::vector<size_t>& sourceColumns) const {
+     // A posição no arquivo identifica a coluna se não houver cabeçalho
+     VectorStr names(sourceColumns.size());
+     for (size_t col = 0; col < sourceColumns.size(); ++col) {
+         names[col] = col < m_headers.size() ? m_headers[col] : std::to_string(sourceColumns[col]);
+     }
+     return names;
+ }
+ 
+ void CSV::setColumns(std::vector<std::vector<std::string_view>>& cells, const std::shared_ptr<const void>& owner,
+                      const ReadOptions& options, const VectorStr& names, const Schema* minimumTypes) {
+     m_columns.reserve(cells.size());
+     for (size_t col = 0; col < cells.size(); ++col) {
+         m_columns.push_back(makeColumn(names[col], std::move(cells[col]), owner, options, minimumTypes));
+     }
+     updateSchema(names);
+ }
+ 
+ void CSV::parseData(const char* dataStart, const char* end, std::shared_ptr<const void> owner,
+                     const ReadOptions& options, const std::vector<size_t>& sourceColumns) {
+     // Campos de colunas não selecionadas são descartados pelo tokenizador
+     size_t columnCount = sourceColumns.size();
+     std::vector<size_t> fieldSlots = fieldSlotsFor(sourceColumns);
+     VectorStr names = columnNames(sourceColumns);
+ 
+     // numThreads = 0 usa o pool compartilhado da biblioteca
+     size_t dataSize = static_cast<size_t>(end - dataStart);
+     std::shared_ptr<ThreadPool> pool;
+     size_t numThreads = 1;
+     // Com nrows, uma única varredura para na última linha pedida
+     if (options.numThreads != 1 && options.nrows == 0 && dataSize >= kParallelMinBytes) {
+         pool = options.numThreads == 0 ? ThreadPool::global() : std::make_shared<ThreadPool>(options.numThreads);
+         numThreads = pool->size();
+     }
+ 
+     // Dividir os dados em blocos, cada um começando no início de uma linha
+     // fora de aspas. O estado de aspas em cada posição candidata vem do
+     // kernel de varredura: cada trecho entre candidatas é varrido em
+     // paralelo a partir dos dois estados iniciais possíveis, e os
+     // resultados são encadeados em ordem
+     std::vector<const char*> boundaries;
+     boundaries.push_back(dataStart);
+     if (numThreads > 1) {
+         // Uma candidata nunca segue uma aspa, de modo que apenas o estado
+         // de aspas (e não o início de campo) depende do trecho anterior
+         std::vector<const char*> candidates;
+         candidates.push_back(dataStart);
+         for (size_t i = 1; i < numThreads; ++i) {
+             const char* candidate = std::max(dataStart + dataSize * i / numThreads, candidates.back());
+             while (candidate < end && candidate > dataStart && candidate[-1] == '"') {
+                 candidate++;
+             }
+             candidates.push_back(candidate);
          }
  
-         // Avançar para além dos caracteres de nova linha
-         if (current < end && *current == '\r') current++;
-         if (current < end && *current == '\n') current++;
-         
-         lineStart = current;
+         static const detail::SimdLevel level = detail::scannerSimdLevel();
+         std::vector<std::array<detail::ScanState, 2>> segmentEnd(numThreads - 1);
+         pool->parallelFor(2 * (numThreads - 1), [&](size_t task) {
+             size_t segment = task / 2;
+             if (segment == 0 && task % 2 == 1) {
+                 return;  // O primeiro trecho começa fora de aspas
+             }
+             detail::ScanState state;
+             state.inQuotes = task % 2 == 1;
+             if (segment > 0) {
+                 char previous = candidates[segment][-1];
+                 state.fieldStart = previous == m_delimiter || previous == '\n' || previous == '\r';
+             }
+             detail::scanQuoteState(candidates[segment], candidates[segment + 1] - candidates[segment],
+                                    m_delimiter, state, level);
+             segmentEnd[segment][task % 2] = state;
+         });
+ 
+         bool inQuotes = false;
+         for (size_t i = 1; i < numThreads; ++i) {
+             detail::ScanState state = segmentEnd[i - 1][inQuotes ? 1 : 0];
+             inQuotes = state.inQuotes;
+             boundaries.push_back(std::max(skipLine(candidates[i], end, m_delimiter, state), boundaries.back()));
+         }
      }
+     boundaries.push_back(end);
+     size_t chunkCount = boundaries.size() - 1;
  
-     // Processar todas as linhas de uma vez de forma otimizada
-     while (lineStart < end) {
-         current = lineStart;
-         
-         // Encontrar fim da linha
-         while (current < end && *current != '\n' && *current != '\r') {
-             current++;
+     auto text = std::make_shared<ParsedText>();
+     text->source = owner;
+     text->unescaped.resize(chunkCount);
+ 
+     // Sem dono externo, os campos de texto são copiados pelas colunas
+     std::shared_ptr<const void> fieldOwner;
+     if (owner) {
+         fieldOwner = text;
+     }
+ 
+     // Os campos são distribuídos diretamente em colunas, sem cópias, e
+     // convertidos para o tipo final uma única vez, ao fim da leitura
+     std::vector<std::vector<std::string_view>> cells(columnCount);
+ 
+     if (chunkCount == 1) {
+         m_rowCount = parseRows(dataStart, end, cells, fieldSlots, text->unescaped[0], options.nrows);
+         setColumns(cells, fieldOwner, options, names, nullptr);
+         return;
+     }
+ 
+     std::vector<std::vector<std::vector<std::string_view>>> chunkCells(
+         chunkCount, std::vector<std::vector<std::string_view>>(columnCount));
+     std::vector<size_t> chunkRows(chunkCount, 0);
+ 
+     pool->parallelFor(chunkCount, [&](size_t chunk) {
+         chunkRows[chunk] = parseRows(boundaries[chunk], boundaries[chunk + 1],
+                                      chunkCells[chunk], fieldSlots, text->unescaped[chunk]);
+     });
+ 
+     // Reunir os blocos em ordem e converter as colunas em paralelo
+     m_columns.resize(columnCount);
+     pool->parallelFor(columnCount, [&](size_t col) {
+         auto& column = cells[col];
+         size_t total = 0;
+         for (const auto& chunk : chunkCells) {
+             total += chunk[col].size();
          }
-         
-         // Processar linha (pular linhas vazias)
-         if (current > lineStart) {
-             std::string line(lineStart, current - lineStart);
-             Row row = parseLine(line, m_delimiter);
-             m_data.push_back(std::move(row));
+         column.reserve(total);
+         for (auto& chunk : chunkCells) {
+             column.insert(column.end(), chunk[col].begin(), chunk[col].end());
+             std::vector<std::string_view>().swap(chunk[col]);
          }
-         
-         // Avançar para a próxima linha
-         if (current < end && *current == '\r') current++;
-         if (current < end && *current == '\n') current++;
-         
-         lineStart = current;
+         m_columns[col] = makeColumn(names[col], std::move(column), fieldOwner, options, nullptr);
+     });
+ 
+     for (size_t rows : chunkRows) {
+         m_rowCount += rows;
      }
+     updateSchema(names);
+ }
  
-     return true;
+ ColumnBuffer CSV::makeColumn(const std::string& name, std::vector<std::string_view> cells,
+                              const std::shared_ptr<const void>& owner, const ReadOptions& options,
+                              const Schema* minimumTypes) const {
+     bool hasMinimum = minimumTypes && minimumTypes->contains(name);
+     if (options.schema.contains(name)) {
+         DType dtype = options.schema.dtype(name);
+         if (hasMinimum) {
+             dtype = ColumnBuffer::commonDType(dtype, minimumTypes->dtype(name));
+         }
+         return ColumnBuffer::fromViews(std::move(cells), dtype, owner);
+     }
+     if (hasMinimum) {
+         return ColumnBuffer::fromViews(std::move(cells), owner, options.inferenceRows, minimumTypes->dtype(name));
+     }
+     return ColumnBuffer::fromViews(std::move(cells), owner, options.inferenceRows);
  }
  
- size_t CSV::rowCount() const {
-     return m_data.size();
+ void CSV::updateSchema(const VectorStr& names) {
+     m_schema = Schema();
+     for (size_t i = 0; i < m_columns.size(); ++i) {
+         m_schema.set(names[i], m_columns[i].dtype());
+     }
  }
  
- size_t CSV::columnCount() const {
-     if (m_data.empty()) {
+ size_t CSV::parseRows(const char* begin, const char* end, std::vector<std::vector<std::string_view>>& cells,
+                       const std::vector<size_t>& fieldSlots, detail::StringArena& unescaped,
+                       size_t maxRows) const {
+     if (begin == end) {
          return 0;
      }
-     return m_data[0].size();
+ 
+     // Estimar o número de linhas pelo tamanho da primeira, evitando uma
+     // passada extra sobre os dados só para contar quebras de linha
+     const char* firstLineEnd = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+     size_t firstLineSize = firstLineEnd ? static_cast<size_t>(firstLineEnd - begin) + 1 : 0;
+     if (firstLineSize > 0) {
+         size_t estimatedLines = static_cast<size_t>(end - begin) / firstLineSize + 1;
+         if (maxRows > 0) {
+             estimatedLines = std::min(estimatedLines, maxRows);
+         }
+         for (auto& cell : cells) {
+             cell.reserve(estimatedLines + estimatedLines / 8);
+         }
+     }
+ 
+     size_t rowCount = 0;
+     size_t fieldIndex = 0;
+     size_t filled = 0;  // Colunas selecionadas já preenchidas na linha atual
+ 
+     detail::tokenize(begin, end, m_delimiter,
+         [&](std::string_view field, bool escaped) {
+             // Linhas irregulares: campos excedentes são descartados, assim
+             // como os campos de colunas não selecionadas
+             if (fieldIndex < fieldSlots.size() && fieldSlots[fieldIndex] != kSkippedField) {
+                 if (escaped) {
+                     field = unescaped.emplace(field.size(), [field](char* out) {
+                         return detail::unescapeQuotes(field, out);
+                     });
+                 }
+                 cells[fieldSlots[fieldIndex]].push_back(field);
+                 filled++;
+             }
+             fieldIndex++;
+         },
+         [&]() {
+             // Campos ausentes são tratados como nulos
+             for (; filled < cells.size(); ++filled) {
+                 cells[filled].push_back(std::string_view());
+             }
+             fieldIndex = 0;
+             filled = 0;
+             rowCount++;
+             return maxRows == 0 || rowCount < maxRows;
+         });
+ 
+     return rowCount;
+ }
+ 
+ size_t CSV::rowCount() const {
+     return m_rowCount;
+ }
+ 
+ size_t CSV::columnCount() const {
+     return m_columns.size();
  }
  
  const std::vector<std::string>& CSV::headers() const {
@@ -125,128 +534,282 @@
  }
  
  CSV::Row CSV::getRow(size_t rowIndex) const {
-     if (rowIndex >= m_data.size()) {
+     return rowView(rowIndex).toVector();
+ }
+ 
+ RowView CSV::rowView(size_t rowIndex) const {
+     if (rowIndex >= m_rowCount) {
          throw std::out_of_range("Row index out of range");
      }
-     return m_data[rowIndex];
+     return RowView(*this, rowIndex);
  }
  
  CSV::Column CSV::getColumn(const std::string& columnName) const {
-     auto it = m_headerMap.find(columnName);
-     if (it == m_headerMap.end()) {
-         throw std::out_of_range("Column name not found");
-     }
-     return getColumn(it->second);
+     return getColumn(columnIndex(columnName));
  }
  
  CSV::Column CSV::getColumn(size_t columnIndex) const {
-     if (m_data.empty() || columnIndex >= m_data[0].size()) {
+     const ColumnBuffer& buffer = column(columnIndex);
+ 
+     if (buffer.dtype() == DType::String) {
+         auto values = buffer.strings();
+         return Column(values.begin(), values.end());
+     }
+ 
+     return columnView(columnIndex).toVector();
+ }
+ 
+ const ColumnBuffer& CSV::column(size_t columnIndex) const {
+     if (columnIndex >= m_columns.size()) {
          throw std::out_of_range("Column index out of range");
      }
+     return m_columns[columnIndex];
+ }
+ 
+ const ColumnBuffer& CSV::column(const std::string& columnName) const {
+     return m_columns[columnIndex(columnName)];
+ }
  
-     Column column;
-     column.reserve(m_data.size());  // Pré-alocar para evitar realocações
+ void CSV::setColumn(size_t columnIndex, ColumnBuffer column) {
+     if (columnIndex >= m_columns.size()) {
+         throw std::out_of_range("Column index out of range");
+     }
+     if (column.size() != m_rowCount) {
+         throw std::invalid_argument("Column length does not match row count");
+     }
+     m_schema.set(m_headers[columnIndex], column.dtype());
+     m_columns[columnIndex] = std::move(column);
+     m_rowCache = std::make_shared<RowCache>();
+ }
  
-     for (const auto& row : m_data) {
-         column.push_back(row[columnIndex]);
+ size_t CSV::columnIndex(const std::string& columnName) const {
+     auto it = m_headerMap.find(columnName);
+     if (it == m_headerMap.end() || it->second >= m_columns.size()) {
+         throw std::out_of_range("Column name not found");
      }
+     return it->second;
+ }
  
-     return column;
+ bool CSV::hasColumn(const std::string& columnName) const {
+     auto it = m_headerMap.find(columnName);
+     return it != m_headerMap.end() && it->second < m_columns.size();
  }
  
  const CSV::DataFrame& CSV::data() const {
-     return m_data;
+     // Chamadas const concorrentes esperam a primeira montar a matriz
+     std::call_once(m_rowCache->buildOnce, [this]() {
+         DataFrame& rows = m_rowCache->rows;
+         rows.reserve(m_rowCount);
+         for (size_t i = 0; i < m_rowCount; ++i) {
+             rows.push_back(RowView(*this, i).toVector());
+         }
+     });
+     return m_rowCache->rows;
  }
  
  bool CSV::save(const std::string& filename, char delimiter) const {
-     std::ofstream file(filename, std::ios::binary);  // Modo binário para melhor desempenho
-     if (!file.is_open()) {
-         return false;
+     WriteOptions options;
+     options.delimiter = delimiter;
+     return save(filename, options);
+ }
+ 
+ namespace {
+ 
+ // Tamanho inicial do buffer de leitura incremental
+ constexpr size_t kChunkReadSize = 4 << 20;
+ 
+ } // namespace
+ 
+ CSV::ChunkReader::ChunkReader(const std::string& filename, size_t chunkSize, const ReadOptions& options)
+     : m_file(filename, std::ios::binary), m_options(options), m_chunkSize(chunkSize),
+       m_schema(options.schema) {
+     if (chunkSize == 0) {
+         throw std::invalid_argument("Chunk size must be greater than zero");
+     }
+     if (!m_file.is_open()) {
+         return;
      }
  
-     // Estimar tamanho do buffer necessário
-     size_t estimatedSize = 0;
-     
-     // Cabeçalho
-     if (!m_headers.empty()) {
-         for (const auto& header : m_headers) {
-             estimatedSize += header.size() + 1; // +1 para o delimitador
-         }
-         estimatedSize += 1; // Para o \n
+     m_buffer.resize(kChunkReadSize);
+     fill();
+ 
+     VectorStr fields;
+     for (size_t i = 0; i < m_options.skiprows; ++i) {
+         readRecord(fields, true);
      }
-     
-     // Dados
-     for (const auto& row : m_data) {
-         for (const auto& cell : row) {
-             estimatedSize += cell.size() + 1; // +1 para o delimitador
+ 
+     // A primeira linha é o cabeçalho ou, sem ele, a linha que define o número de colunas
+     readRecord(fields, m_options.hasHeader);
+     m_sourceColumns = selectColumns(fields, fields.size(), m_options);
+     m_fieldSlots = fieldSlotsFor(m_sourceColumns);
+     if (m_options.hasHeader) {
+         for (size_t source : m_sourceColumns) {
+             m_headers.push_back(std::move(fields[source]));
          }
-         estimatedSize += 1; // Para o \n
      }
-     
-     // Criar buffer
-     std::string buffer;
-     buffer.reserve(estimatedSize);
-     
-     // Escrever cabeçalho se existir
-     if (!m_headers.empty()) {
-         for (size_t i = 0; i < m_headers.size(); ++i) {
-             if (i > 0) {
-                 buffer += delimiter;
+ }
+ 
+ void CSV::ChunkReader::readRecord(VectorStr& fields, bool consume) {
+     for (;;) {
+         fields.clear();
+         bool complete = false;
+         const char* stop = detail::tokenize(m_buffer.data() + m_begin, m_buffer.data() + m_end,
+             m_options.delimiter,
+             [&fields](std::string_view field, bool escaped) {
+                 fields.push_back(escaped ? detail::unescapeQuotes(field) : std::string(field));
+             },
+             [&complete]() { complete = true; return false; },
+             m_eof, m_positions);
+ 
+         if (complete || m_eof) {
+             if (consume) {
+                 m_begin = static_cast<size_t>(stop - m_buffer.data());
              }
-             buffer += m_headers[i];
+             return;
          }
-         buffer += '\n';
+         fill();
      }
+ }
  
-     // Escrever dados
-     for (const auto& row : m_data) {
-         for (size_t i = 0; i < row.size(); ++i) {
-             if (i > 0) {
-                 buffer += delimiter;
-             }
-             buffer += row[i];
-         }
-         buffer += '\n';
+ bool CSV::ChunkReader::fill() {
+     if (m_eof) {
+         return false;
      }
-     
-     // Escrever tudo de uma vez
-     file.write(buffer.data(), buffer.size());
  
+     // Mover os dados não consumidos para o início do buffer
+     if (m_begin > 0) {
+         std::memmove(m_buffer.data(), m_buffer.data() + m_begin, m_end - m_begin);
+         m_end -= m_begin;
+         m_begin = 0;
+     }
+ 
+     // Uma única linha maior que o buffer exige crescê-lo
+     if (m_end == m_buffer.size()) {
+         m_buffer.resize(m_buffer.size() * 2);
+     }
+ 
+     m_file.read(m_buffer.data() + m_end, static_cast<std::streamsize>(m_buffer.size() - m_end));
+     m_end += static_cast<size_t>(m_file.gcount());
+     if (m_end < m_buffer.size()) {
+         m_eof = true;
+     }
      return true;
  }
  
- CSV::Row CSV::parseLine(const std::string& line, char delimiter) const {
-     Row result;
-     
-     // Evitar realocações estimando número de campos
-     size_t estimatedFields = std::count(line.begin(), line.end(), delimiter) + 1;
-     result.reserve(estimatedFields);
-     
-     // Implementação otimizada sem stringstream
-     size_t pos = 0;
-     size_t nextDelimiter = 0;
-     
-     while ((nextDelimiter = line.find(delimiter, pos)) != std::string::npos) {
-         std::string field = line.substr(pos, nextDelimiter - pos);
-         
-         // Remover caracteres de nova linha
-         field.erase(std::remove_if(field.begin(), field.end(), [](unsigned char c) {
-             return c == '\r' || c == '\n';
-         }), field.end());
-         
-         result.push_back(std::move(field));
-         pos = nextDelimiter + 1;
+ bool CSV::ChunkReader::next(CSV& batch) {
+     if (!m_file.is_open()) {
+         return false;
      }
-     
-     // Adicionar o último campo
-     std::string lastField = line.substr(pos);
-     lastField.erase(std::remove_if(lastField.begin(), lastField.end(), [](unsigned char c) {
-         return c == '\r' || c == '\n';
-     }), lastField.end());
-     
-     result.push_back(std::move(lastField));
-     
-     return result;
+ 
+     // Com nrows, o último lote é truncado e a leitura termina ao atingi-lo
+     size_t limit = m_chunkSize;
+     if (m_options.nrows > 0) {
+         limit = std::min(limit, m_options.nrows - m_rowsRead);
+         if (limit == 0) {
+             return false;
+         }
+     }
+ 
+     // As linhas são contadas e os campos separados por coluna em uma única
+     // passada, lendo mais blocos se necessário. Os campos são guardados pela
+     // posição relativa ao início do lote, que não muda quando fill() move
+     // ou realoca o buffer; campos com escape vão para um texto à parte
+     struct FieldSpan {
+         size_t offset;
+         size_t size;
+     };
+     constexpr size_t kEscapedField = size_t(1) << (sizeof(size_t) * 8 - 1);
+ 
+     size_t columnCount = m_sourceColumns.size();
+     std::vector<std::vector<FieldSpan>> spans(columnCount);
+     std::string unescaped;
+     size_t rows = 0;
+     size_t fieldIndex = 0;
+     size_t filled = 0;  // Colunas selecionadas já preenchidas na linha atual
+     size_t scanFrom = m_begin;
+     const char* batchEnd = nullptr;
+ 
+     for (;;) {
+         const char* batchStart = m_buffer.data() + m_begin;
+         const char* stop = detail::tokenize(m_buffer.data() + scanFrom, m_buffer.data() + m_end,
+             m_options.delimiter,
+             [&](std::string_view field, bool escaped) {
+                 // Campos excedentes e de colunas não selecionadas são descartados
+                 if (fieldIndex < m_fieldSlots.size() && m_fieldSlots[fieldIndex] != kSkippedField) {
+                     FieldSpan span{static_cast<size_t>(field.data() - batchStart), field.size()};
+                     if (escaped) {
+                         size_t start = unescaped.size();
+                         unescaped.resize(start + field.size());
+                         span = FieldSpan{start | kEscapedField, detail::unescapeQuotes(field, unescaped.data() + start)};
+                         unescaped.resize(start + span.size);
+                     }
+                     spans[m_fieldSlots[fieldIndex]].push_back(span);
+                     filled++;
+                 }
+                 fieldIndex++;
+             },
+             [&]() {
+                 // Campos ausentes são tratados como nulos
+                 for (; filled < columnCount; ++filled) {
+                     spans[filled].push_back(FieldSpan{0, 0});
+                 }
+                 fieldIndex = 0;
+                 filled = 0;
+                 return ++rows < limit;
+             },
+             m_eof, m_positions);
+ 
+         if (rows == limit || m_eof) {
+             batchEnd = stop;
+             break;
+         }
+ 
+         // Os campos da linha incompleta são lidos de novo após fill()
+         for (auto& column : spans) {
+             column.resize(rows);
+         }
+         fieldIndex = 0;
+         filled = 0;
+ 
+         size_t consumed = m_begin;
+         scanFrom = static_cast<size_t>(stop - m_buffer.data());
+         fill();
+         scanFrom -= consumed - m_begin;
+     }
+ 
+     if (rows == 0) {
+         m_begin = m_end;
+         return false;
+     }
+ 
+     const char* batchStart = m_buffer.data() + m_begin;
+     std::vector<std::vector<std::string_view>> cells(columnCount);
+     for (size_t col = 0; col < columnCount; ++col) {
+         cells[col].reserve(rows);
+         for (const FieldSpan& span : spans[col]) {
+             const char* data = (span.offset & kEscapedField) ? unescaped.data() + (span.offset & ~kEscapedField)
+                                                              : batchStart + span.offset;
+             cells[col].emplace_back(data, span.size);
+         }
+         std::vector<FieldSpan>().swap(spans[col]);
+     }
+ 
+     // Os campos de texto são copiados, pois o buffer será reaproveitado.
+     // Os tipos inferidos são combinados com os dos lotes anteriores antes
+     // da conversão: uma coluna só é ampliada quando um valor deste lote não
+     // cabe no tipo atual, e nenhum valor é descartado
+     batch.m_hasHeader = m_options.hasHeader;
+     batch.m_delimiter = m_options.delimiter;
+     batch.m_columns.clear();
+     batch.m_rowCount = rows;
+     batch.m_rowCache = std::make_shared<RowCache>();
+     batch.setHeaders(m_headers);
+     batch.setColumns(cells, nullptr, m_options, batch.columnNames(m_sourceColumns), &m_schema);
+     m_schema = batch.m_schema;
+ 
+     m_begin = static_cast<size_t>(batchEnd - m_buffer.data());
+     m_rowsRead += rows;
+     return true;
  }
  
  } // namespace CPPandas
\ No newline at end of file
@@ -0,0 +1,108 @@
+/**
+ * @file frequency.cpp
+ * @brief Implementação da contagem de valores distintos de colunas
+ */
+
+#include "cppandas/frequency.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <utility>
+
+namespace CPPandas {
+
+namespace {
+
+// Conta os valores válidos de cada bloco em uma tabela própria e combina
+// as tabelas na ordem das linhas
+template <typename Key, typename Values, typename IsValid>
+std::vector<ValueFrequency> countKeys(const Values& values, IsValid isValid, const ExecutionPolicy& policy) {
+    std::mutex partsMutex;
+    std::vector<std::pair<size_t, FrequencyTable<Key>>> parts;
+    policy.forEachChunk(values.size(), 1, [&](size_t begin, size_t end) {
+        FrequencyTable<Key> table;
+        for (size_t row = begin; row < end; ++row) {
+            if (isValid(values[row])) {
+                table.add(static_cast<Key>(values[row]), row);
+            }
+        }
+        std::lock_guard<std::mutex> lock(partsMutex);
+        parts.emplace_back(begin, std::move(table));
+    });
+
+    std::vector<ValueFrequency> result;
+    if (parts.empty()) {
+        return result;
+    }
+    std::sort(parts.begin(), parts.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+    FrequencyTable<Key>& merged = parts.front().second;
+    for (size_t i = 1; i < parts.size(); ++i) {
+        merged.merge(parts[i].second);
+    }
+
+    result.reserve(merged.size());
+    for (const auto& entry : merged.entries()) {
+        result.push_back({entry.firstRow, entry.count});
+    }
+    return result;
+}
+
+// Categorias: os códigos indexam diretamente um vetor de contagens, sem hash
+template <typename Code>
+std::vector<ValueFrequency> countCodes(std::span<const Code> codes, size_t categoryCount,
+                                       const ExecutionPolicy& policy) {
+    constexpr Code kNull = std::numeric_limits<Code>::max();
+    std::vector<ValueFrequency> counts(categoryCount, ValueFrequency{SIZE_MAX, 0});
+    std::mutex countsMutex;
+    policy.forEachChunk(codes.size(), 1, [&](size_t begin, size_t end) {
+        std::vector<ValueFrequency> part(categoryCount, ValueFrequency{SIZE_MAX, 0});
+        for (size_t row = begin; row < end; ++row) {
+            Code code = codes[row];
+            if (code != kNull) {
+                ValueFrequency& entry = part[code];
+                entry.firstRow = std::min(entry.firstRow, row);
+                entry.count++;
+            }
+        }
+        std::lock_guard<std::mutex> lock(countsMutex);
+        for (size_t i = 0; i < categoryCount; ++i) {
+            counts[i].firstRow = std::min(counts[i].firstRow, part[i].firstRow);
+            counts[i].count += part[i].count;
+        }
+    });
+
+    std::erase_if(counts, [](const ValueFrequency& entry) { return entry.count == 0; });
+    std::sort(counts.begin(), counts.end(), [](const ValueFrequency& a, const ValueFrequency& b) {
+        return a.firstRow < b.firstRow;
+    });
+    return counts;
+}
+
+} // namespace
+
+std::vector<ValueFrequency> countValues(const ColumnBuffer& column, const ExecutionPolicy& policy) {
+    auto always = [](auto) { return true; };
+    switch (column.dtype()) {
+        case DType::Float64:
+            return countKeys<double>(column.float64(), [](double value) { return !std::isnan(value); }, policy);
+        case DType::Int64:
+            return countKeys<int64_t>(column.int64(), always, policy);
+        case DType::Bool:
+            return countKeys<int64_t>(column.boolean(), always, policy);
+        case DType::Datetime:
+            return countKeys<int64_t>(column.datetime(), [](int64_t value) { return value != kNaT; }, policy);
+        case DType::String:
+            return countKeys<std::string_view>(column.strings(),
+                                               [](std::string_view value) { return !value.empty(); }, policy);
+        case DType::Category:
+            return column.visitCodes([&](auto codes) {
+                return countCodes(codes, column.categories().size(), policy);
+            }, std::vector<ValueFrequency>());
+    }
+    return {};
+}
+
+} // namespace CPPandas
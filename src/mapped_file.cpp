@@ -0,0 +1,104 @@
+/**
+ * @file mapped_file.cpp
+ * @brief Implementação do mapeamento de arquivos em memória (POSIX e Windows)
+ */
+
+#include "cppandas/mapped_file.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace CPPandas {
+
+std::shared_ptr<const MappedFile> MappedFile::open(const std::string& filename) {
+    std::shared_ptr<MappedFile> mapped(new MappedFile());
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+    mapped->m_file = file;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        return nullptr;
+    }
+    mapped->m_size = static_cast<size_t>(fileSize.QuadPart);
+
+    // Arquivos vazios não podem ser mapeados, mas são válidos
+    if (mapped->m_size == 0) {
+        return mapped;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        return nullptr;
+    }
+    mapped->m_mapping = mapping;
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        return nullptr;
+    }
+    mapped->m_data = static_cast<const char*>(view);
+#else
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        return nullptr;
+    }
+    mapped->m_size = static_cast<size_t>(st.st_size);
+
+    // Arquivos vazios não podem ser mapeados, mas são válidos
+    if (mapped->m_size == 0) {
+        ::close(fd);
+        return mapped;
+    }
+
+    void* view = mmap(nullptr, mapped->m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // O mapeamento continua válido após fechar o descritor
+    if (view == MAP_FAILED) {
+        mapped->m_size = 0;
+        return nullptr;
+    }
+    mapped->m_data = static_cast<const char*>(view);
+
+    // A leitura inicial é sequencial; o kernel pode antecipar as páginas
+    madvise(view, mapped->m_size, MADV_SEQUENTIAL);
+#endif
+
+    return mapped;
+}
+
+MappedFile::~MappedFile() {
+#ifdef _WIN32
+    if (m_data != nullptr) {
+        UnmapViewOfFile(m_data);
+    }
+    if (m_mapping != nullptr) {
+        CloseHandle(m_mapping);
+    }
+    if (m_file != nullptr) {
+        CloseHandle(m_file);
+    }
+#else
+    if (m_data != nullptr) {
+        munmap(const_cast<char*>(m_data), m_size);
+    }
+#endif
+}
+
+} // namespace CPPandas
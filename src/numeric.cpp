@@ -0,0 +1,360 @@
+/**
+ * @file numeric.cpp
+ * @brief Implementação da conversão numérica e de datas sem exceções
+ */
+
+#include "cppandas/numeric.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+#include <limits>
+#include <system_error>
+
+namespace CPPandas {
+
+namespace {
+
+// Remove espaços nas extremidades e o sinal '+' inicial, que from_chars não aceita
+std::string_view trimNumber(std::string_view text) {
+    size_t start = 0;
+    size_t end = text.size();
+    while (start < end && (text[start] == ' ' || text[start] == '\t')) {
+        start++;
+    }
+    while (end > start && (text[end - 1] == ' ' || text[end - 1] == '\t')) {
+        end--;
+    }
+    if (start + 1 < end && text[start] == '+' && text[start + 1] != '-') {
+        start++;
+    }
+    return text.substr(start, end - start);
+}
+
+template <typename T>
+ParseResult<T> parseNumber(std::string_view text) {
+    ParseResult<T> result;
+    text = trimNumber(text);
+    if (text.empty()) {
+        return result;
+    }
+
+    const char* end = text.data() + text.size();
+    auto [ptr, ec] = std::from_chars(text.data(), end, result.value);
+    if (ec == std::errc::result_out_of_range) {
+        result.status = ParseStatus::OutOfRange;
+    } else if (ec != std::errc() || ptr != end) {
+        result.status = ParseStatus::Invalid;
+    } else {
+        result.status = ParseStatus::Ok;
+    }
+    return result;
+}
+
+constexpr int64_t kNanosPerSecond = 1000000000;
+constexpr int64_t kSecondsPerDay = 86400;
+
+// Lê de 1 a maxDigits dígitos decimais, avançando o texto
+bool readNumber(std::string_view& text, size_t maxDigits, int& value) {
+    size_t length = 0;
+    value = 0;
+    while (length < text.size() && length < maxDigits && text[length] >= '0' && text[length] <= '9') {
+        value = value * 10 + (text[length] - '0');
+        length++;
+    }
+    text.remove_prefix(length);
+    return length > 0;
+}
+
+bool readChar(std::string_view& text, char expected) {
+    if (text.empty() || text.front() != expected) {
+        return false;
+    }
+    text.remove_prefix(1);
+    return true;
+}
+
+bool isLeapYear(int year) {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+int daysInMonth(int year, int month) {
+    static const int days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    return month == 2 && isLeapYear(year) ? 29 : days[month - 1];
+}
+
+// Dias desde 1970-01-01 no calendário gregoriano proléptico
+int64_t daysFromCivil(int year, int month, int day) {
+    year -= month <= 2;
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const int64_t yearOfEra = year - era * 400;
+    const int64_t dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+void civilFromDays(int64_t days, int& year, int& month, int& day) {
+    days += 719468;
+    const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    const int64_t dayOfEra = days - era * 146097;
+    const int64_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    const int64_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    const int64_t monthIndex = (5 * dayOfYear + 2) / 153;
+    day = static_cast<int>(dayOfYear - (153 * monthIndex + 2) / 5 + 1);
+    month = static_cast<int>(monthIndex < 10 ? monthIndex + 3 : monthIndex - 9);
+    year = static_cast<int>(yearOfEra + era * 400 + (month <= 2));
+}
+
+template <typename Cell>
+NumericBuffer convertColumn(std::span<const Cell> cells) {
+    NumericBuffer buffer;
+    buffer.values.resize(cells.size());
+    buffer.valid.resize(cells.size());
+
+    // Como na leitura, marcadores nulos ("NaN", "NA", ...) e valores que
+    // from_chars converte para NaN não são válidos
+    for (size_t i = 0; i < cells.size(); ++i) {
+        std::string_view cell = cells[i];
+        bool isNull = isNullValue(cell);
+        ParseResult<double> parsed = isNull ? ParseResult<double>{} : parseDouble(cell);
+        bool ok = !isNull && parsed.ok() && !std::isnan(parsed.value);
+        buffer.values[i] = ok ? parsed.value : std::numeric_limits<double>::quiet_NaN();
+        buffer.valid[i] = ok;
+        buffer.validCount += ok;
+        buffer.emptyCount += isNull;
+    }
+
+    return buffer;
+}
+
+} // namespace
+
+bool detail::isNullMarker(std::string_view text) {
+    auto isSpace = [](char c) { return c == ' ' || c == '\t' || c == '\r'; };
+    size_t start = 0;
+    size_t end = text.size();
+    while (start < end && isSpace(text[start])) {
+        start++;
+    }
+    while (end > start && isSpace(text[end - 1])) {
+        end--;
+    }
+    static constexpr std::string_view kNullValues[] = {
+        "", "NA", "N/A", "n/a", "NaN", "nan", "-NaN", "-nan", "NULL", "null", "None", "<NA>",
+        "#N/A", "#N/A N/A", "#NA", "1.#IND", "-1.#IND", "1.#QNAN", "-1.#QNAN"};
+    std::string_view trimmed = text.substr(start, end - start);
+    return std::find(std::begin(kNullValues), std::end(kNullValues), trimmed) != std::end(kNullValues);
+}
+
+ParseResult<double> parseDouble(std::string_view text) {
+    return parseNumber<double>(text);
+}
+
+ParseResult<int64_t> parseInt64(std::string_view text) {
+    return parseNumber<int64_t>(text);
+}
+
+ParseResult<bool> parseBool(std::string_view text) {
+    ParseResult<bool> result;
+    if (text.empty()) {
+        return result;
+    }
+    if (text == "True" || text == "true" || text == "TRUE") {
+        result.value = true;
+        result.status = ParseStatus::Ok;
+    } else if (text == "False" || text == "false" || text == "FALSE") {
+        result.value = false;
+        result.status = ParseStatus::Ok;
+    } else {
+        result.status = ParseStatus::Invalid;
+    }
+    return result;
+}
+
+ParseResult<int64_t> parseDatetime(std::string_view text) {
+    ParseResult<int64_t> result;
+    text = trimNumber(text);
+    if (text.empty()) {
+        return result;
+    }
+    result.status = ParseStatus::Invalid;
+
+    // Data: AAAA-MM-DD, AAAA/MM/DD ou M/D/AAAA
+    int year = 0;
+    int month = 0;
+    int day = 0;
+    std::string_view rest = text;
+    int first = 0;
+    size_t firstStart = rest.size();
+    if (!readNumber(rest, 4, first)) {
+        return result;
+    }
+    size_t firstDigits = firstStart - rest.size();
+    if (firstDigits == 4) {
+        char separator = rest.empty() ? '\0' : rest.front();
+        if ((separator != '-' && separator != '/') || !readChar(rest, separator) ||
+            !readNumber(rest, 2, month) || !readChar(rest, separator) || !readNumber(rest, 2, day)) {
+            return result;
+        }
+        year = first;
+    } else if (firstDigits <= 2) {
+        month = first;
+        if (!readChar(rest, '/') || !readNumber(rest, 2, day) || !readChar(rest, '/')) {
+            return result;
+        }
+        size_t yearStart = rest.size();
+        if (!readNumber(rest, 4, year) || yearStart - rest.size() != 4) {
+            return result;
+        }
+    } else {
+        return result;
+    }
+
+    if (month < 1 || month > 12 || day < 1 || day > daysInMonth(year, month)) {
+        return result;
+    }
+
+    // Hora opcional: HH:MM[:SS[.fração]]
+    int hour = 0;
+    int minute = 0;
+    int second = 0;
+    int64_t fraction = 0;
+    if (!rest.empty()) {
+        if (rest.front() != ' ' && rest.front() != 'T') {
+            return result;
+        }
+        rest.remove_prefix(1);
+        if (!readNumber(rest, 2, hour) || !readChar(rest, ':') || !readNumber(rest, 2, minute)) {
+            return result;
+        }
+        if (readChar(rest, ':')) {
+            if (!readNumber(rest, 2, second)) {
+                return result;
+            }
+            if (readChar(rest, '.')) {
+                int64_t scale = kNanosPerSecond;
+                size_t digits = 0;
+                while (!rest.empty() && rest.front() >= '0' && rest.front() <= '9') {
+                    if (scale > 1) {
+                        scale /= 10;
+                        fraction += (rest.front() - '0') * scale;
+                    }
+                    rest.remove_prefix(1);
+                    digits++;
+                }
+                if (digits == 0) {
+                    return result;
+                }
+            }
+        }
+        if (!rest.empty() || hour > 23 || minute > 59 || second > 59) {
+            return result;
+        }
+    }
+
+    // Limites de um int64 em nanossegundos (como datetime64[ns] do pandas)
+    if (year < 1678 || year > 2261) {
+        result.status = ParseStatus::OutOfRange;
+        return result;
+    }
+
+    int64_t seconds = daysFromCivil(year, month, day) * kSecondsPerDay + hour * 3600 + minute * 60 + second;
+    result.value = seconds * kNanosPerSecond + fraction;
+    result.status = ParseStatus::Ok;
+    return result;
+}
+
+namespace {
+
+// Escreve value com exatamente width dígitos (zeros à esquerda)
+char* writeDigits(char* out, int64_t value, int width) {
+    for (int i = width - 1; i >= 0; --i) {
+        out[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    return out + width;
+}
+
+} // namespace
+
+size_t formatDatetime(int64_t nanoseconds, char* out) {
+    int64_t seconds = nanoseconds / kNanosPerSecond;
+    int64_t fraction = nanoseconds % kNanosPerSecond;
+    if (fraction < 0) {
+        fraction += kNanosPerSecond;
+        seconds--;
+    }
+    int64_t days = seconds / kSecondsPerDay;
+    int64_t secondOfDay = seconds % kSecondsPerDay;
+    if (secondOfDay < 0) {
+        secondOfDay += kSecondsPerDay;
+        days--;
+    }
+
+    int year, month, day;
+    civilFromDays(days, year, month, day);
+
+    char* cursor = out;
+    if (year < 0 || year > 9999) {
+        // Fora do intervalo de quatro dígitos: largura mínima 4, incluindo o sinal
+        char digits[16];
+        auto result = std::to_chars(digits, digits + sizeof(digits), std::abs(year));
+        size_t length = static_cast<size_t>(result.ptr - digits);
+        if (year < 0) {
+            *cursor++ = '-';
+            length++;
+        }
+        for (size_t i = length; i < 4; ++i) {
+            *cursor++ = '0';
+        }
+        cursor = std::copy(digits, result.ptr, cursor);
+    } else {
+        cursor = writeDigits(cursor, year, 4);
+    }
+    *cursor++ = '-';
+    cursor = writeDigits(cursor, month, 2);
+    *cursor++ = '-';
+    cursor = writeDigits(cursor, day, 2);
+    if (secondOfDay != 0 || fraction != 0) {
+        *cursor++ = ' ';
+        cursor = writeDigits(cursor, secondOfDay / 3600, 2);
+        *cursor++ = ':';
+        cursor = writeDigits(cursor, secondOfDay / 60 % 60, 2);
+        *cursor++ = ':';
+        cursor = writeDigits(cursor, secondOfDay % 60, 2);
+        if (fraction != 0) {
+            *cursor++ = '.';
+            cursor = writeDigits(cursor, fraction, 9);
+            while (cursor[-1] == '0') {
+                cursor--;
+            }
+        }
+    }
+    return static_cast<size_t>(cursor - out);
+}
+
+size_t formatFloat64(double value, char* out) {
+    char* end = std::to_chars(out, out + kFloat64TextSize - 2, value).ptr;
+    std::string_view text(out, static_cast<size_t>(end - out));
+    if (text.find_first_of(".ein") == std::string_view::npos) {
+        *end++ = '.';
+        *end++ = '0';
+    }
+    return static_cast<size_t>(end - out);
+}
+
+std::string formatDatetime(int64_t nanoseconds) {
+    char buffer[kDatetimeTextSize];
+    return std::string(buffer, formatDatetime(nanoseconds, buffer));
+}
+
+NumericBuffer toNumeric(std::span<const std::string_view> cells) {
+    return convertColumn(cells);
+}
+
+NumericBuffer toNumeric(std::span<const std::string> cells) {
+    return convertColumn(cells);
+}
+
+} // namespace CPPandas
@@ -0,0 +1,247 @@
+/**
+ * @file quantile.cpp
+ * @brief Implementação do cálculo de quantis por seleção e do t-digest
+ */
+
+#include "cppandas/quantile.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <stdexcept>
+
+namespace CPPandas {
+
+namespace {
+
+void validateQuantiles(std::span<const double> qs) {
+    for (double q : qs) {
+        if (!(q >= 0.0 && q <= 1.0)) {
+            throw std::invalid_argument("Quantile value must be between 0 and 1");
+        }
+    }
+}
+
+// Posições q * (n - 1) arredondadas para baixo e para cima
+struct QuantilePosition {
+    size_t lower;
+    size_t upper;
+    double fraction;
+};
+
+QuantilePosition quantilePosition(double q, size_t size) {
+    double index = q * (size - 1);
+    size_t lower = static_cast<size_t>(index);
+    return {lower, std::min(lower + 1, size - 1), index - lower};
+}
+
+// Coloca em values[p] o valor de posição p da ordenação, para cada p em
+// positions (ordenado e sem repetições). Todos os valores de [begin, end)
+// estão entre os já posicionados à esquerda e à direita do intervalo.
+void selectPositions(std::span<double> values, size_t begin, size_t end,
+                     std::span<const size_t> positions) {
+    if (positions.empty() || end - begin < 2) {
+        return;
+    }
+    size_t middle = positions.size() / 2;
+    size_t pivot = positions[middle];
+    std::nth_element(values.begin() + begin, values.begin() + pivot, values.begin() + end);
+    selectPositions(values, begin, pivot, positions.first(middle));
+    selectPositions(values, pivot + 1, end, positions.subspan(middle + 1));
+}
+
+} // namespace
+
+std::vector<double> selectQuantiles(std::span<double> values, std::span<const double> qs) {
+    validateQuantiles(qs);
+    std::vector<double> result(qs.size(), std::numeric_limits<double>::quiet_NaN());
+    if (values.empty()) {
+        return result;
+    }
+
+    std::vector<size_t> positions;
+    positions.reserve(qs.size() * 2);
+    for (double q : qs) {
+        QuantilePosition position = quantilePosition(q, values.size());
+        positions.push_back(position.lower);
+        positions.push_back(position.upper);
+    }
+    std::sort(positions.begin(), positions.end());
+    positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+
+    selectPositions(values, 0, values.size(), positions);
+    return sortedQuantiles(values, qs);
+}
+
+std::vector<double> sortedQuantiles(std::span<const double> sorted, std::span<const double> qs) {
+    validateQuantiles(qs);
+    std::vector<double> result(qs.size(), std::numeric_limits<double>::quiet_NaN());
+    if (sorted.empty()) {
+        return result;
+    }
+
+    for (size_t k = 0; k < qs.size(); ++k) {
+        QuantilePosition position = quantilePosition(qs[k], sorted.size());
+        double lowerValue = sorted[position.lower];
+        double upperValue = sorted[position.upper];
+        result[k] = lowerValue + position.fraction * (upperValue - lowerValue);
+    }
+    return result;
+}
+
+namespace {
+
+// Centroides acumulados antes de uma fusão, por unidade de compressão
+constexpr double kBufferFactor = 8.0;
+
+// Escala k1 do t-digest: k(q) = delta / (2 pi) * asin(2q - 1). Devolve o
+// maior quantil que um centroide iniciado em q pode alcançar (k + 1).
+double nextQuantileLimit(double q, double compression) {
+    double angle = std::asin(2.0 * q - 1.0) + 2.0 * std::numbers::pi / compression;
+    if (angle >= std::numbers::pi / 2) {
+        return 1.0;
+    }
+    return (std::sin(angle) + 1.0) / 2.0;
+}
+
+} // namespace
+
+TDigest::TDigest(double compression) : m_compression(std::max(compression, 20.0)) {}
+
+TDigest TDigest::forAccuracy(double accuracy) {
+    if (!(accuracy > 0.0 && accuracy < 1.0)) {
+        throw std::invalid_argument("Accuracy must be between 0 and 1");
+    }
+    return TDigest(1.0 / accuracy);
+}
+
+void TDigest::add(double value, double weight) {
+    if (std::isnan(value) || !(weight > 0.0)) {
+        return;
+    }
+    m_buffer.push_back({value, weight});
+    m_count += weight;
+    m_min = std::min(m_min, value);
+    m_max = std::max(m_max, value);
+    if (m_buffer.size() >= kBufferFactor * m_compression) {
+        compress();
+    }
+}
+
+void TDigest::add(std::span<const double> values) {
+    for (double value : values) {
+        add(value);
+    }
+}
+
+void TDigest::merge(const TDigest& other) {
+    if (other.empty()) {
+        return;
+    }
+    m_buffer.insert(m_buffer.end(), other.m_centroids.begin(), other.m_centroids.end());
+    m_buffer.insert(m_buffer.end(), other.m_buffer.begin(), other.m_buffer.end());
+    m_count += other.m_count;
+    m_min = std::min(m_min, other.m_min);
+    m_max = std::max(m_max, other.m_max);
+    compress();
+}
+
+void TDigest::compress() {
+    if (m_buffer.empty()) {
+        return;
+    }
+    m_buffer.insert(m_buffer.end(), m_centroids.begin(), m_centroids.end());
+    m_centroids = mergeCentroids(std::move(m_buffer), m_compression);
+    m_buffer.clear();
+}
+
+std::vector<TDigest::Centroid> TDigest::mergeCentroids(std::vector<Centroid> centroids, double compression) {
+    if (centroids.empty()) {
+        return centroids;
+    }
+    std::sort(centroids.begin(), centroids.end(), [](const Centroid& a, const Centroid& b) {
+        return a.mean < b.mean;
+    });
+
+    double total = 0.0;
+    for (const Centroid& centroid : centroids) {
+        total += centroid.weight;
+    }
+
+    // Fusão gulosa: um centroide absorve os vizinhos enquanto não ultrapassar
+    // uma unidade da escala k1 a partir do quantil em que começa
+    std::vector<Centroid> merged;
+    Centroid current = centroids[0];
+    double weightBefore = 0.0;
+    double limit = nextQuantileLimit(0.0, compression);
+    for (size_t i = 1; i < centroids.size(); ++i) {
+        const Centroid& next = centroids[i];
+        if ((weightBefore + current.weight + next.weight) / total <= limit) {
+            current.weight += next.weight;
+            current.mean += (next.mean - current.mean) * next.weight / current.weight;
+        } else {
+            weightBefore += current.weight;
+            merged.push_back(current);
+            limit = nextQuantileLimit(weightBefore / total, compression);
+            current = next;
+        }
+    }
+    merged.push_back(current);
+    return merged;
+}
+
+double TDigest::quantile(double q) const {
+    return quantiles(std::span<const double>(&q, 1))[0];
+}
+
+std::vector<double> TDigest::quantiles(std::span<const double> qs) const {
+    validateQuantiles(qs);
+    std::vector<double> result(qs.size(), std::numeric_limits<double>::quiet_NaN());
+    if (empty()) {
+        return result;
+    }
+
+    std::vector<Centroid> pending;
+    if (!m_buffer.empty()) {
+        pending = m_buffer;
+        pending.insert(pending.end(), m_centroids.begin(), m_centroids.end());
+        pending = mergeCentroids(std::move(pending), m_compression);
+    }
+    const std::vector<Centroid>& centroids = m_buffer.empty() ? m_centroids : pending;
+
+    // Interpolação linear entre os centros dos centroides, na escala de
+    // posições 0..n-1: o centro de um centroide de peso w que começa na
+    // posição p fica em p + (w - 1) / 2; o mínimo e o máximo ficam nas pontas
+    std::vector<double> ranks;
+    std::vector<double> values;
+    ranks.reserve(centroids.size() + 2);
+    values.reserve(centroids.size() + 2);
+    ranks.push_back(0.0);
+    values.push_back(m_min);
+    double weightBefore = 0.0;
+    for (const Centroid& centroid : centroids) {
+        ranks.push_back(weightBefore + (centroid.weight - 1.0) / 2.0);
+        values.push_back(std::clamp(centroid.mean, m_min, m_max));
+        weightBefore += centroid.weight;
+    }
+    ranks.push_back(m_count - 1.0);
+    values.push_back(m_max);
+
+    for (size_t k = 0; k < qs.size(); ++k) {
+        double rank = qs[k] * (m_count - 1.0);
+        size_t upper = static_cast<size_t>(std::lower_bound(ranks.begin(), ranks.end(), rank) - ranks.begin());
+        if (upper == 0) {
+            result[k] = values.front();
+        } else if (upper >= ranks.size()) {
+            result[k] = values.back();
+        } else {
+            double span = ranks[upper] - ranks[upper - 1];
+            double fraction = span > 0.0 ? (rank - ranks[upper - 1]) / span : 1.0;
+            result[k] = values[upper - 1] + fraction * (values[upper] - values[upper - 1]);
+        }
+    }
+    return result;
+}
+
+} // namespace CPPandas
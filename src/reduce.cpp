@@ -0,0 +1,398 @@
+/**
+ * @file reduce.cpp
+ * @brief Kernels de redução e padronização numérica (escalar, AVX2 e AVX-512) com despacho em tempo de execução
+ */
+
+#include "cppandas/reduce.hpp"
+#include "simd.hpp"
+#include <bit>
+
+namespace CPPandas {
+namespace detail {
+
+/**
+ * @brief Reduz valores float64 deslocados por @p shift com a implementação indicada
+ *
+ * Exposto para que as implementações possam ser comparadas entre si.
+ */
+Reduction reduceFloat64(std::span<const double> values, double shift, SimdLevel level);
+
+} // namespace detail
+
+namespace {
+
+constexpr double kInfinity = std::numeric_limits<double>::infinity();
+
+// Soma com compensação de Kahan
+struct KahanSum {
+    double sum = 0.0;
+    double compensation = 0.0;
+
+    void add(double value) {
+        double y = value - compensation;
+        double t = sum + y;
+        compensation = (t - sum) - y;
+        sum = t;
+    }
+
+    double value() const { return sum - compensation; }
+};
+
+// Acumuladores escalares, usados pelo laço escalar, pelo resto dos
+// laços vetoriais e para reunir as faixas dos vetores. Infinitos são
+// contados à parte e ficam fora das somas: na compensação de Kahan eles
+// produziriam inf - inf = NaN
+struct Accumulator {
+    size_t count = 0;
+    size_t positiveInfinities = 0;
+    size_t negativeInfinities = 0;
+    double min = kInfinity;
+    double max = -kInfinity;
+    KahanSum sum;
+    KahanSum sumsq;
+
+    void add(double value, double shift) {
+        if (std::isnan(value)) {
+            return;
+        }
+        if (std::isinf(value)) {
+            addInfinity(value);
+            return;
+        }
+        double delta = value - shift;
+        sum.add(delta);
+        sumsq.add(delta * delta);
+        min = std::min(min, value);
+        max = std::max(max, value);
+        count++;
+    }
+
+    void addInfinity(double value) {
+        (value > 0 ? positiveInfinities : negativeInfinities)++;
+        min = std::min(min, value);
+        max = std::max(max, value);
+        count++;
+    }
+
+    // Reúne uma faixa de vetor (soma e compensação já separadas)
+    void addLane(double laneSum, double laneSumComp, double laneSumsq, double laneSumsqComp,
+                 double laneMin, double laneMax) {
+        sum.add(laneSum);
+        sum.add(-laneSumComp);
+        sumsq.add(laneSumsq);
+        sumsq.add(-laneSumsqComp);
+        min = std::min(min, laneMin);
+        max = std::max(max, laneMax);
+    }
+
+    Reduction finish(double shift) const {
+        Reduction result;
+        result.count = count;
+        result.positiveInfinities = positiveInfinities;
+        result.negativeInfinities = negativeInfinities;
+        result.shift = shift;
+        if (count > 0) {
+            result.min = min;
+            result.max = max;
+            result.shiftedSum = sum.value();
+            result.shiftedSumsq = sumsq.value();
+        }
+        return result;
+    }
+};
+
+Reduction reduceScalar(std::span<const double> values, double shift) {
+    Accumulator acc;
+    for (double value : values) {
+        acc.add(value, shift);
+    }
+    return acc.finish(shift);
+}
+
+#if defined(CPPANDAS_X86)
+struct LanesAVX2 {
+    __m256d sum, sumComp, sumsq, sumsqComp, min, max;
+};
+
+CPPANDAS_TARGET("avx2") inline void kahanAddAVX2(__m256d& sum, __m256d& comp, __m256d value) {
+    __m256d y = _mm256_sub_pd(value, comp);
+    __m256d t = _mm256_add_pd(sum, y);
+    comp = _mm256_sub_pd(_mm256_sub_pd(t, sum), y);
+    sum = t;
+}
+
+// NaN é detectado com uma comparação ordenada (x == x) e zerado por máscara.
+// Infinitos (x - x não é 0) também ficam fora das somas e são contados à parte
+CPPANDAS_TARGET("avx2") inline void accumulateAVX2(LanesAVX2& lanes, __m256d x, __m256d shift, Accumulator& acc) {
+    __m256d valid = _mm256_cmp_pd(x, x, _CMP_ORD_Q);
+    __m256d finite = _mm256_cmp_pd(_mm256_sub_pd(x, x), _mm256_setzero_pd(), _CMP_EQ_OQ);
+    __m256d delta = _mm256_and_pd(finite, _mm256_sub_pd(x, shift));
+    kahanAddAVX2(lanes.sum, lanes.sumComp, delta);
+    kahanAddAVX2(lanes.sumsq, lanes.sumsqComp, _mm256_mul_pd(delta, delta));
+    lanes.min = _mm256_min_pd(lanes.min, _mm256_blendv_pd(_mm256_set1_pd(kInfinity), x, valid));
+    lanes.max = _mm256_max_pd(lanes.max, _mm256_blendv_pd(_mm256_set1_pd(-kInfinity), x, valid));
+
+    unsigned validBits = static_cast<unsigned>(_mm256_movemask_pd(valid));
+    acc.count += static_cast<size_t>(std::popcount(validBits));
+    if ((validBits & ~static_cast<unsigned>(_mm256_movemask_pd(finite))) != 0) [[unlikely]] {
+        unsigned positive = static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(x, _mm256_set1_pd(kInfinity), _CMP_EQ_OQ)));
+        unsigned negative = static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(x, _mm256_set1_pd(-kInfinity), _CMP_EQ_OQ)));
+        acc.positiveInfinities += static_cast<size_t>(std::popcount(positive));
+        acc.negativeInfinities += static_cast<size_t>(std::popcount(negative));
+    }
+}
+
+CPPANDAS_TARGET("avx2") inline void mergeAVX2(Accumulator& acc, const LanesAVX2& lanes) {
+    alignas(32) double sum[4], sumComp[4], sumsq[4], sumsqComp[4], min[4], max[4];
+    _mm256_store_pd(sum, lanes.sum);
+    _mm256_store_pd(sumComp, lanes.sumComp);
+    _mm256_store_pd(sumsq, lanes.sumsq);
+    _mm256_store_pd(sumsqComp, lanes.sumsqComp);
+    _mm256_store_pd(min, lanes.min);
+    _mm256_store_pd(max, lanes.max);
+    for (int i = 0; i < 4; ++i) {
+        acc.addLane(sum[i], sumComp[i], sumsq[i], sumsqComp[i], min[i], max[i]);
+    }
+}
+
+CPPANDAS_TARGET("avx2")
+Reduction reduceAVX2(std::span<const double> values, double shift) {
+    const double* data = values.data();
+    const size_t size = values.size();
+    const __m256d shiftVector = _mm256_set1_pd(shift);
+
+    // Dois conjuntos de acumuladores independentes escondem a latência das somas
+    LanesAVX2 lanes[2];
+    for (auto& lane : lanes) {
+        lane.sum = lane.sumComp = lane.sumsq = lane.sumsqComp = _mm256_setzero_pd();
+        lane.min = _mm256_set1_pd(kInfinity);
+        lane.max = _mm256_set1_pd(-kInfinity);
+    }
+
+    Accumulator acc;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        accumulateAVX2(lanes[0], _mm256_loadu_pd(data + i), shiftVector, acc);
+        accumulateAVX2(lanes[1], _mm256_loadu_pd(data + i + 4), shiftVector, acc);
+    }
+    mergeAVX2(acc, lanes[0]);
+    mergeAVX2(acc, lanes[1]);
+
+    for (; i < size; ++i) {
+        acc.add(data[i], shift);
+    }
+    return acc.finish(shift);
+}
+
+struct LanesAVX512 {
+    __m512d sum, sumComp, sumsq, sumsqComp, min, max;
+};
+
+CPPANDAS_TARGET("avx512f") inline void kahanAddAVX512(__m512d& sum, __m512d& comp, __m512d value) {
+    __m512d y = _mm512_sub_pd(value, comp);
+    __m512d t = _mm512_add_pd(sum, y);
+    comp = _mm512_sub_pd(_mm512_sub_pd(t, sum), y);
+    sum = t;
+}
+
+// Com AVX-512 a máscara de validade é um registrador de máscara: as faixas
+// inválidas (NaN ou além do fim dos dados) simplesmente não são atualizadas.
+// Infinitos entram no mínimo e no máximo, mas não nas somas
+CPPANDAS_TARGET("avx512f")
+inline void accumulateAVX512(LanesAVX512& lanes, __m512d x, __m512d shift, __mmask8 loaded, Accumulator& acc) {
+    __mmask8 valid = _mm512_cmp_pd_mask(x, x, _CMP_ORD_Q) & loaded;
+    __mmask8 finite = _mm512_cmp_pd_mask(_mm512_sub_pd(x, x), _mm512_setzero_pd(), _CMP_EQ_OQ) & loaded;
+    __m512d delta = _mm512_maskz_sub_pd(finite, x, shift);
+    kahanAddAVX512(lanes.sum, lanes.sumComp, delta);
+    kahanAddAVX512(lanes.sumsq, lanes.sumsqComp, _mm512_mul_pd(delta, delta));
+    lanes.min = _mm512_mask_min_pd(lanes.min, valid, lanes.min, x);
+    lanes.max = _mm512_mask_max_pd(lanes.max, valid, lanes.max, x);
+    acc.count += static_cast<size_t>(std::popcount(static_cast<unsigned>(valid)));
+    if ((valid & ~finite) != 0) [[unlikely]] {
+        __mmask8 positive = _mm512_cmp_pd_mask(x, _mm512_set1_pd(kInfinity), _CMP_EQ_OQ) & loaded;
+        __mmask8 negative = _mm512_cmp_pd_mask(x, _mm512_set1_pd(-kInfinity), _CMP_EQ_OQ) & loaded;
+        acc.positiveInfinities += static_cast<size_t>(std::popcount(static_cast<unsigned>(positive)));
+        acc.negativeInfinities += static_cast<size_t>(std::popcount(static_cast<unsigned>(negative)));
+    }
+}
+
+CPPANDAS_TARGET("avx512f") inline void mergeAVX512(Accumulator& acc, const LanesAVX512& lanes) {
+    alignas(64) double sum[8], sumComp[8], sumsq[8], sumsqComp[8], min[8], max[8];
+    _mm512_store_pd(sum, lanes.sum);
+    _mm512_store_pd(sumComp, lanes.sumComp);
+    _mm512_store_pd(sumsq, lanes.sumsq);
+    _mm512_store_pd(sumsqComp, lanes.sumsqComp);
+    _mm512_store_pd(min, lanes.min);
+    _mm512_store_pd(max, lanes.max);
+    for (int i = 0; i < 8; ++i) {
+        acc.addLane(sum[i], sumComp[i], sumsq[i], sumsqComp[i], min[i], max[i]);
+    }
+}
+
+CPPANDAS_TARGET("avx512f")
+Reduction reduceAVX512(std::span<const double> values, double shift) {
+    const double* data = values.data();
+    const size_t size = values.size();
+    const __m512d shiftVector = _mm512_set1_pd(shift);
+
+    LanesAVX512 lanes[2];
+    for (auto& lane : lanes) {
+        lane.sum = lane.sumComp = lane.sumsq = lane.sumsqComp = _mm512_setzero_pd();
+        lane.min = _mm512_set1_pd(kInfinity);
+        lane.max = _mm512_set1_pd(-kInfinity);
+    }
+
+    Accumulator acc;
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        accumulateAVX512(lanes[0], _mm512_loadu_pd(data + i), shiftVector, 0xFF, acc);
+        accumulateAVX512(lanes[1], _mm512_loadu_pd(data + i + 8), shiftVector, 0xFF, acc);
+    }
+    // Resto: carregamentos mascarados, sem laço escalar
+    for (; i < size; i += 8) {
+        size_t remaining = std::min<size_t>(size - i, 8);
+        __mmask8 loaded = static_cast<__mmask8>((1u << remaining) - 1);
+        accumulateAVX512(lanes[0], _mm512_maskz_loadu_pd(loaded, data + i), shiftVector, loaded, acc);
+    }
+    mergeAVX512(acc, lanes[0]);
+    mergeAVX512(acc, lanes[1]);
+    return acc.finish(shift);
+}
+#endif
+
+detail::SimdLevel reductionSimdLevel() {
+    static const detail::SimdLevel level = detail::detectSimdLevel();
+    return level;
+}
+
+// Deslocamento: o primeiro valor válido, se finito
+template <typename T>
+double shiftFor(std::span<const T> values) {
+    for (T value : values) {
+        double converted = static_cast<double>(value);
+        if (!std::isnan(converted)) {
+            return std::isfinite(converted) ? converted : 0.0;
+        }
+    }
+    return 0.0;
+}
+
+// Inteiros e booleanos são convertidos em blocos e reduzidos pelo mesmo kernel
+template <typename T>
+Reduction reduceConverted(std::span<const T> values) {
+    constexpr size_t kBlockSize = 1024;
+    const double shift = shiftFor(values);
+    const detail::SimdLevel level = reductionSimdLevel();
+
+    double block[kBlockSize];
+    Accumulator acc;
+    for (size_t start = 0; start < values.size(); start += kBlockSize) {
+        size_t length = std::min(kBlockSize, values.size() - start);
+        for (size_t i = 0; i < length; ++i) {
+            block[i] = static_cast<double>(values[start + i]);
+        }
+        Reduction part = detail::reduceFloat64(std::span<const double>(block, length), shift, level);
+        if (part.count > 0) {
+            acc.count += part.count;
+            acc.positiveInfinities += part.positiveInfinities;
+            acc.negativeInfinities += part.negativeInfinities;
+            acc.addLane(part.shiftedSum, 0.0, part.shiftedSumsq, 0.0, part.min, part.max);
+        }
+    }
+    return acc.finish(shift);
+}
+
+void standardizeScalar(const double* values, double mean, double scale, double* out, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        out[i] = (values[i] - mean) / scale;
+    }
+}
+
+#if defined(CPPANDAS_X86)
+CPPANDAS_TARGET("avx2")
+void standardizeAVX2(const double* values, double mean, double scale, double* out, size_t size) {
+    const __m256d meanVector = _mm256_set1_pd(mean);
+    const __m256d scaleVector = _mm256_set1_pd(scale);
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        __m256d x = _mm256_loadu_pd(values + i);
+        _mm256_storeu_pd(out + i, _mm256_div_pd(_mm256_sub_pd(x, meanVector), scaleVector));
+    }
+    standardizeScalar(values + i, mean, scale, out + i, size - i);
+}
+
+CPPANDAS_TARGET("avx512f")
+void standardizeAVX512(const double* values, double mean, double scale, double* out, size_t size) {
+    const __m512d meanVector = _mm512_set1_pd(mean);
+    const __m512d scaleVector = _mm512_set1_pd(scale);
+    for (size_t i = 0; i < size; i += 8) {
+        size_t remaining = std::min<size_t>(size - i, 8);
+        __mmask8 loaded = static_cast<__mmask8>((1u << remaining) - 1);
+        __m512d x = _mm512_maskz_loadu_pd(loaded, values + i);
+        _mm512_mask_storeu_pd(out + i, loaded, _mm512_div_pd(_mm512_sub_pd(x, meanVector), scaleVector));
+    }
+}
+#endif
+
+void standardizeFloat64(const double* values, double mean, double scale, double* out, size_t size) {
+#if defined(CPPANDAS_X86)
+    switch (reductionSimdLevel()) {
+        case detail::SimdLevel::AVX512: return standardizeAVX512(values, mean, scale, out, size);
+        case detail::SimdLevel::AVX2: return standardizeAVX2(values, mean, scale, out, size);
+        default: break;
+    }
+#endif
+    standardizeScalar(values, mean, scale, out, size);
+}
+
+// Inteiros e booleanos são convertidos diretamente no destino e padronizados em lugar
+template <typename T>
+void standardizeConverted(std::span<const T> values, double mean, double scale, std::span<double> out) {
+    for (size_t i = 0; i < values.size(); ++i) {
+        out[i] = static_cast<double>(values[i]);
+    }
+    standardizeFloat64(out.data(), mean, scale, out.data(), out.size());
+}
+
+} // namespace
+
+Reduction detail::reduceFloat64(std::span<const double> values, double shift, detail::SimdLevel level) {
+#if defined(CPPANDAS_X86)
+    switch (level) {
+        case detail::SimdLevel::AVX512: return reduceAVX512(values, shift);
+        case detail::SimdLevel::AVX2: return reduceAVX2(values, shift);
+        default: break;
+    }
+#else
+    (void)level;
+#endif
+    return reduceScalar(values, shift);
+}
+
+Reduction reduce(std::span<const double> values) {
+    return detail::reduceFloat64(values, shiftFor(values), reductionSimdLevel());
+}
+
+Reduction reduce(std::span<const int64_t> values) {
+    return reduceConverted(values);
+}
+
+Reduction reduce(std::span<const uint8_t> values) {
+    return reduceConverted(values);
+}
+
+void standardize(std::span<const double> values, double mean, double scale, std::span<double> out) {
+    standardizeFloat64(values.data(), mean, scale, out.data(), std::min(values.size(), out.size()));
+}
+
+void standardize(std::span<const int64_t> values, double mean, double scale, std::span<double> out) {
+    const size_t size = std::min(values.size(), out.size());
+    standardizeConverted(values.first(size), mean, scale, out.first(size));
+}
+
+void standardize(std::span<const uint8_t> values, double mean, double scale, std::span<double> out) {
+    const size_t size = std::min(values.size(), out.size());
+    standardizeConverted(values.first(size), mean, scale, out.first(size));
+}
+
+} // namespace CPPandas
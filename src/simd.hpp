@@ -0,0 +1,89 @@
+/**
+ * @file simd.hpp
+ * @brief Detecção de recursos SIMD da CPU e macros para despacho em tempo de execução
+ *
+ * Cabeçalho interno: os kernels vetorizados são compilados com atributos de
+ * alvo por função, de modo que a biblioteca roda em qualquer CPU x86-64 e
+ * escolhe a melhor implementação disponível na primeira chamada.
+ */
+
+#ifndef CPPANDAS_SIMD_HPP
+#define CPPANDAS_SIMD_HPP
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define CPPANDAS_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define CPPANDAS_TARGET(isa) __attribute__((target(isa)))
+#define CPPANDAS_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define CPPANDAS_TARGET(isa)
+#define CPPANDAS_ALWAYS_INLINE __forceinline
+#endif
+
+namespace CPPandas {
+namespace detail {
+
+/**
+ * @brief Níveis de instruções vetoriais suportados pelos kernels
+ */
+enum class SimdLevel {
+    Scalar,  ///< Sem instruções vetoriais
+    SSE2,    ///< Vetores de 128 bits (base em x86-64)
+    AVX2,    ///< Vetores de 256 bits
+    AVX512   ///< Vetores de 512 bits (AVX-512F; inclui AVX2)
+};
+
+/**
+ * @brief Detecta o melhor nível SIMD suportado pela CPU e pelo sistema operacional
+ * @return Nível SIMD disponível
+ */
+inline SimdLevel detectSimdLevel() {
+#if defined(CPPANDAS_X86)
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2")) {
+        return SimdLevel::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return SimdLevel::SSE2;
+    }
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    int maxLeaf = info[0];
+    __cpuid(info, 1);
+    bool sse2 = (info[3] & (1 << 26)) != 0;
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    if (osxsave && avx && maxLeaf >= 7 && (_xgetbv(0) & 0x6) == 0x6) {
+        __cpuidex(info, 7, 0);
+        bool avx2 = (info[1] & (1 << 5)) != 0;
+        bool avx512f = (info[1] & (1 << 16)) != 0;
+        if (avx2 && avx512f && (_xgetbv(0) & 0xE6) == 0xE6) {
+            return SimdLevel::AVX512;
+        }
+        if (avx2) {
+            return SimdLevel::AVX2;
+        }
+    }
+    if (sse2) {
+        return SimdLevel::SSE2;
+    }
+#endif
+#endif
+    return SimdLevel::Scalar;
+}
+
+} // namespace detail
+} // namespace CPPandas
+
+#endif // CPPANDAS_SIMD_HPP
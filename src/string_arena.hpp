@@ -0,0 +1,125 @@
+/**
+ * @file string_arena.hpp
+ * @brief Armazenamento contíguo de texto em blocos, com liberação em massa
+ *
+ * Cabeçalho interno. Colunas de texto que não referenciam o buffer do
+ * arquivo (campos com aspas escapadas, leitura em lotes, conversões) guardam
+ * seus valores em uma arena: os caracteres ficam lado a lado em poucos
+ * blocos grandes e os valores são std::string_view sobre eles. Não há uma
+ * alocação por valor, e destruir a arena libera todos os blocos de uma vez.
+ */
+
+#ifndef CPPANDAS_STRING_ARENA_HPP
+#define CPPANDAS_STRING_ARENA_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace CPPandas {
+namespace detail {
+
+/**
+ * @class StringArena
+ * @brief Blocos de caracteres onde textos são acrescentados e nunca movidos
+ *
+ * As views devolvidas por append() e emplace() permanecem válidas enquanto
+ * a arena existir. Quando o tamanho total é conhecido, reserve() permite
+ * guardar todos os valores em um único bloco.
+ */
+class StringArena {
+public:
+    /**
+     * @brief Tamanho mínimo de cada bloco
+     */
+    static constexpr size_t kBlockSize = 64 * 1024;
+
+    StringArena() = default;
+    StringArena(const StringArena&) = delete;
+    StringArena& operator=(const StringArena&) = delete;
+    StringArena(StringArena&&) = default;
+    StringArena& operator=(StringArena&&) = default;
+
+    /**
+     * @brief Garante espaço contíguo para os próximos @p bytes caracteres
+     *
+     * Se faltar espaço, o novo bloco tem exatamente @p bytes caracteres.
+     *
+     * @param bytes Número de caracteres
+     */
+    void reserve(size_t bytes) {
+        if (bytes > m_remaining) {
+            addBlock(bytes);
+        }
+    }
+
+    /**
+     * @brief Copia um texto para a arena
+     * @param text Texto
+     * @return View sobre a cópia
+     */
+    std::string_view append(std::string_view text) {
+        if (text.empty()) {
+            return std::string_view();
+        }
+        ensure(text.size());
+        char* out = m_cursor;
+        std::memcpy(out, text.data(), text.size());
+        m_cursor += text.size();
+        m_remaining -= text.size();
+        return std::string_view(out, text.size());
+    }
+
+    /**
+     * @brief Escreve um texto diretamente na arena
+     *
+     * A função recebe o destino, com espaço para @p maxSize caracteres, e
+     * devolve quantos escreveu; o espaço não usado volta para a arena.
+     *
+     * @param maxSize Tamanho máximo do texto
+     * @param write Função que escreve o texto
+     * @return View sobre o texto escrito
+     */
+    template <typename Write>
+    std::string_view emplace(size_t maxSize, Write write) {
+        ensure(maxSize);
+        char* out = m_cursor;
+        size_t size = std::min<size_t>(write(out), maxSize);
+        m_cursor += size;
+        m_remaining -= size;
+        return std::string_view(out, size);
+    }
+
+    /**
+     * @brief Obtém o número de caracteres alocados em blocos
+     * @return Soma dos tamanhos dos blocos
+     */
+    size_t capacity() const { return m_capacity; }
+
+private:
+    void ensure(size_t bytes) {
+        if (bytes > m_remaining) {
+            addBlock(std::max(bytes, kBlockSize));
+        }
+    }
+
+    void addBlock(size_t size) {
+        m_blocks.push_back(std::make_unique_for_overwrite<char[]>(size));
+        m_cursor = m_blocks.back().get();
+        m_remaining = size;
+        m_capacity += size;
+    }
+
+    std::vector<std::unique_ptr<char[]>> m_blocks;  ///< Blocos, liberados juntos
+    char* m_cursor = nullptr;                       ///< Próximo caractere livre do bloco atual
+    size_t m_remaining = 0;                         ///< Caracteres livres no bloco atual
+    size_t m_capacity = 0;                          ///< Soma dos tamanhos dos blocos
+};
+
+} // namespace detail
+} // namespace CPPandas
+
+#endif // CPPANDAS_STRING_ARENA_HPP
@@ -0,0 +1,201 @@
+/**
+ * @file thread_pool.cpp
+ * @brief Implementação do pool de threads com roubo de tarefas
+ */
+
+#include "cppandas/thread_pool.hpp"
+#include <algorithm>
+
+namespace CPPandas {
+
+namespace {
+
+// Pool e fila da thread atual, se ela pertencer a um pool
+thread_local const ThreadPool* t_currentPool = nullptr;
+thread_local size_t t_currentWorker = 0;
+
+// Estado do pool compartilhado
+std::mutex g_globalMutex;
+std::shared_ptr<ThreadPool> g_globalPool;
+size_t g_globalThreadCount = 0;
+
+} // namespace
+
+ThreadPool::ThreadPool(size_t numThreads) {
+    if (numThreads == 0) {
+        numThreads = defaultThreadCount();
+    }
+
+    m_queues.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i) {
+        m_queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    m_workers.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i) {
+        m_workers.emplace_back([this, i]() { workerLoop(i); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_condition.notify_all();
+
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+size_t ThreadPool::defaultThreadCount() {
+    size_t cores = std::thread::hardware_concurrency();
+    return cores > 0 ? cores : 1;
+}
+
+std::shared_ptr<ThreadPool> ThreadPool::global() {
+    std::lock_guard<std::mutex> lock(g_globalMutex);
+    if (!g_globalPool) {
+        g_globalPool = std::make_shared<ThreadPool>(g_globalThreadCount);
+    }
+    return g_globalPool;
+}
+
+void ThreadPool::setGlobal(std::shared_ptr<ThreadPool> pool) {
+    std::lock_guard<std::mutex> lock(g_globalMutex);
+    g_globalPool = std::move(pool);
+}
+
+void ThreadPool::setGlobalThreadCount(size_t numThreads) {
+    std::lock_guard<std::mutex> lock(g_globalMutex);
+    g_globalThreadCount = numThreads;
+    g_globalPool.reset();
+}
+
+void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)>& body) {
+    if (count == 0) {
+        return;
+    }
+
+    // Estado compartilhado com as tarefas auxiliares. Uma auxiliar que só
+    // começa depois do fim do laço não encontra iterações e não toca em body.
+    struct Loop {
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> done{0};
+        size_t count = 0;
+        const std::function<void(size_t)>* body = nullptr;
+        std::mutex mutex;
+        std::condition_variable finished;
+        std::exception_ptr firstError;
+    };
+    auto loop = std::make_shared<Loop>();
+    loop->count = count;
+    loop->body = &body;
+
+    auto run = [loop]() {
+        for (;;) {
+            size_t i = loop->next.fetch_add(1);
+            if (i >= loop->count) {
+                return;
+            }
+            try {
+                (*loop->body)(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(loop->mutex);
+                if (!loop->firstError) {
+                    loop->firstError = std::current_exception();
+                }
+            }
+            if (loop->done.fetch_add(1) + 1 == loop->count) {
+                std::lock_guard<std::mutex> lock(loop->mutex);
+                loop->finished.notify_all();
+            }
+        }
+    };
+
+    size_t helpers = std::min(count - 1, size());
+    for (size_t i = 0; i < helpers; ++i) {
+        enqueue(run);
+    }
+
+    // A thread que chama também executa iterações, o que evita bloqueios
+    // quando parallelFor é chamado de dentro de uma tarefa do pool
+    run();
+
+    // Aguardar as iterações em andamento antes de propagar erros, pois elas
+    // referenciam dados do chamador
+    {
+        std::unique_lock<std::mutex> lock(loop->mutex);
+        loop->finished.wait(lock, [&]() { return loop->done.load() == loop->count; });
+    }
+
+    if (loop->firstError) {
+        std::rethrow_exception(loop->firstError);
+    }
+}
+
+void ThreadPool::enqueue(std::function<void()> task) {
+    // Tarefas criadas por uma thread do pool ficam na fila dela
+    size_t queue = t_currentPool == this ? t_currentWorker
+                                         : m_nextQueue.fetch_add(1) % m_queues.size();
+    // O contador é incrementado antes da inserção para nunca ficar abaixo
+    // do número real de tarefas nas filas
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queued++;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_queues[queue]->mutex);
+        m_queues[queue]->tasks.push_back(std::move(task));
+    }
+    m_condition.notify_one();
+}
+
+bool ThreadPool::tryPop(size_t worker, std::function<void()>& task) {
+    // Própria fila: a tarefa mais recente
+    {
+        WorkerQueue& own = *m_queues[worker];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            m_queued--;
+            return true;
+        }
+    }
+
+    // Roubo: a tarefa mais antiga de outra fila
+    for (size_t offset = 1; offset < m_queues.size(); ++offset) {
+        WorkerQueue& victim = *m_queues[(worker + offset) % m_queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            m_queued--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::workerLoop(size_t worker) {
+    t_currentPool = this;
+    t_currentWorker = worker;
+
+    for (;;) {
+        std::function<void()> task;
+        if (tryPop(worker, task)) {
+            task();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(lock, [this]() { return m_stopping || m_queued.load() > 0; });
+        if (m_stopping && m_queued.load() == 0) {
+            return;
+        }
+    }
+}
+
+} // namespace CPPandas
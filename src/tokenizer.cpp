@@ -0,0 +1,234 @@
+/**
+ * @file tokenizer.cpp
+ * @brief Kernels de varredura de caracteres estruturais (escalar, SSE2 e AVX2)
+ */
+
+#include "tokenizer.hpp"
+#include <bit>
+#include <cstring>
+
+namespace CPPandas {
+namespace detail {
+
+namespace {
+
+/**
+ * Máscaras de um bloco de 64 bytes: bit i corresponde ao byte i do bloco.
+ */
+struct BlockMasks {
+    uint64_t quotes;      ///< Posições de aspas
+    uint64_t structural;  ///< Posições de delimitadores, '\n' e '\r'
+};
+
+CPPANDAS_ALWAYS_INLINE BlockMasks masksScalar(const char* block, char delimiter) {
+    BlockMasks masks{0, 0};
+    for (int i = 0; i < 64; ++i) {
+        char c = block[i];
+        if (c == '"') {
+            masks.quotes |= uint64_t(1) << i;
+        } else if (c == delimiter || c == '\n' || c == '\r') {
+            masks.structural |= uint64_t(1) << i;
+        }
+    }
+    return masks;
+}
+
+#if defined(CPPANDAS_X86)
+CPPANDAS_ALWAYS_INLINE BlockMasks masksSSE2(const char* block, char delimiter) {
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i delim = _mm_set1_epi8(delimiter);
+    const __m128i newline = _mm_set1_epi8('\n');
+    const __m128i carriage = _mm_set1_epi8('\r');
+
+    BlockMasks masks{0, 0};
+    for (int i = 0; i < 4; ++i) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * i));
+        __m128i isStructural = _mm_or_si128(_mm_cmpeq_epi8(bytes, delim),
+                                            _mm_or_si128(_mm_cmpeq_epi8(bytes, newline),
+                                                         _mm_cmpeq_epi8(bytes, carriage)));
+        masks.quotes |= uint64_t(uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, quote)))) << (16 * i);
+        masks.structural |= uint64_t(uint32_t(_mm_movemask_epi8(isStructural))) << (16 * i);
+    }
+    return masks;
+}
+
+CPPANDAS_TARGET("avx2") inline BlockMasks masksAVX2(const char* block, char delimiter) {
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i delim = _mm256_set1_epi8(delimiter);
+    const __m256i newline = _mm256_set1_epi8('\n');
+    const __m256i carriage = _mm256_set1_epi8('\r');
+
+    BlockMasks masks{0, 0};
+    for (int i = 0; i < 2; ++i) {
+        __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32 * i));
+        __m256i isStructural = _mm256_or_si256(_mm256_cmpeq_epi8(bytes, delim),
+                                               _mm256_or_si256(_mm256_cmpeq_epi8(bytes, newline),
+                                                               _mm256_cmpeq_epi8(bytes, carriage)));
+        masks.quotes |= uint64_t(uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, quote)))) << (32 * i);
+        masks.structural |= uint64_t(uint32_t(_mm256_movemask_epi8(isStructural))) << (32 * i);
+    }
+    return masks;
+}
+#endif
+
+// Bit i do resultado é o XOR dos bits 0..i: marca os bytes entre aspas
+CPPANDAS_ALWAYS_INLINE uint64_t prefixXor(uint64_t bits) {
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+}
+
+// Calcula os bytes entre aspas de um bloco e atualiza o estado da varredura.
+// Como no RFC 4180 e no pandas, uma aspa só abre um campo entre aspas no
+// início do campo; fora disso ela é um caractere literal (ex.: 12" long).
+// Dentro de um campo entre aspas, toda aspa alterna o estado, o que cobre
+// tanto a aspa de fechamento quanto o escape "".
+CPPANDAS_ALWAYS_INLINE uint64_t quotedBytes(BlockMasks masks, uint64_t validBits, ScanState& state) {
+    uint64_t quotes = masks.quotes & validBits;
+    uint64_t structural = masks.structural & validBits;
+    uint64_t initial = state.inQuotes ? ~uint64_t(0) : 0;
+    uint64_t carry = state.fieldStart ? 1 : 0;
+
+    // Supondo que toda aspa alterna o estado, uma aspa que abre um campo
+    // sem seguir um delimitador, quebra de linha ou outra aspa é literal.
+    // Se não houver nenhuma, a suposição vale para o bloco inteiro
+    uint64_t quoted = prefixXor(quotes) ^ initial;
+    uint64_t literal = quotes & quoted & ~(((structural | quotes) << 1) | carry);
+
+    if (literal != 0) [[unlikely]] {
+        // Resolver aspa por aspa; o custo é proporcional ao número de aspas
+        uint64_t toggles = 0;
+        bool inQuotes = state.inQuotes;
+        for (uint64_t pending = quotes; pending != 0; pending &= pending - 1) {
+            int i = std::countr_zero(pending);
+            bool opens = i == 0 ? state.fieldStart : (((structural | toggles) >> (i - 1)) & 1) != 0;
+            if (inQuotes || opens) {
+                toggles |= uint64_t(1) << i;
+                inQuotes = !inQuotes;
+            }
+        }
+        quotes = toggles;
+        quoted = prefixXor(toggles) ^ initial;
+    }
+
+    int last = static_cast<int>(std::bit_width(validBits)) - 1;
+    state.inQuotes = ((quoted >> last) & 1) != 0;
+    state.fieldStart = (((structural | quotes) >> last) & 1) != 0;
+    return quoted;
+}
+
+CPPANDAS_ALWAYS_INLINE size_t emitBlock(BlockMasks masks, uint32_t base, uint64_t validBits,
+                                        ScanState& state, uint32_t* out) {
+    // Caracteres estruturais entre aspas fazem parte do campo
+    uint64_t boundaries = masks.structural & ~quotedBytes(masks, validBits, state) & validBits;
+    size_t count = 0;
+    while (boundaries != 0) {
+        out[count++] = base + static_cast<uint32_t>(std::countr_zero(boundaries));
+        boundaries &= boundaries - 1;
+    }
+    return count;
+}
+
+// Com out == nullptr, apenas o estado da varredura é atualizado
+template <typename MaskFunction>
+CPPANDAS_ALWAYS_INLINE size_t scanLoop(const char* data, size_t length, char delimiter,
+                                       ScanState& state, uint32_t* out, MaskFunction masksOf) {
+    size_t count = 0;
+    size_t offset = 0;
+
+    for (; offset + 64 <= length; offset += 64) {
+        if (out) {
+            count += emitBlock(masksOf(data + offset, delimiter), static_cast<uint32_t>(offset),
+                               ~uint64_t(0), state, out + count);
+        } else {
+            quotedBytes(masksOf(data + offset, delimiter), ~uint64_t(0), state);
+        }
+    }
+
+    // Bloco final incompleto: copiar para um buffer alinhado ao tamanho do bloco
+    if (offset < length) {
+        alignas(64) char tail[64] = {};
+        size_t remaining = length - offset;
+        std::memcpy(tail, data + offset, remaining);
+        uint64_t validBits = (uint64_t(1) << remaining) - 1;
+        if (out) {
+            count += emitBlock(masksOf(tail, delimiter), static_cast<uint32_t>(offset),
+                               validBits, state, out + count);
+        } else {
+            quotedBytes(masksOf(tail, delimiter), validBits, state);
+        }
+    }
+
+    return count;
+}
+
+size_t scanScalar(const char* data, size_t length, char delimiter, ScanState& state, uint32_t* out) {
+    return scanLoop(data, length, delimiter, state, out, masksScalar);
+}
+
+#if defined(CPPANDAS_X86)
+size_t scanSSE2(const char* data, size_t length, char delimiter, ScanState& state, uint32_t* out) {
+    return scanLoop(data, length, delimiter, state, out, masksSSE2);
+}
+
+CPPANDAS_TARGET("avx2")
+size_t scanAVX2(const char* data, size_t length, char delimiter, ScanState& state, uint32_t* out) {
+    return scanLoop(data, length, delimiter, state, out, masksAVX2);
+}
+#endif
+
+size_t scan(const char* data, size_t length, char delimiter, ScanState& state,
+            uint32_t* out, SimdLevel level) {
+#if defined(CPPANDAS_X86)
+    switch (level) {
+        case SimdLevel::AVX512:
+        case SimdLevel::AVX2: return scanAVX2(data, length, delimiter, state, out);
+        case SimdLevel::SSE2: return scanSSE2(data, length, delimiter, state, out);
+        default: break;
+    }
+#else
+    (void)level;
+#endif
+    return scanScalar(data, length, delimiter, state, out);
+}
+
+} // namespace
+
+SimdLevel scannerSimdLevel() {
+    static const SimdLevel level = detectSimdLevel();
+    return level;
+}
+
+size_t scanFieldBoundaries(const char* data, uint32_t length, char delimiter,
+                           ScanState& state, uint32_t* out, SimdLevel level) {
+    return scan(data, length, delimiter, state, out, level);
+}
+
+void scanQuoteState(const char* data, size_t length, char delimiter,
+                    ScanState& state, SimdLevel level) {
+    scan(data, length, delimiter, state, nullptr, level);
+}
+
+std::string unescapeQuotes(std::string_view field) {
+    std::string result(field.size(), '\0');
+    result.resize(unescapeQuotes(field, result.data()));
+    return result;
+}
+
+size_t unescapeQuotes(std::string_view field, char* out) {
+    size_t size = 0;
+    for (size_t i = 0; i < field.size(); ++i) {
+        out[size++] = field[i];
+        if (field[i] == '"' && i + 1 < field.size() && field[i + 1] == '"') {
+            i++;
+        }
+    }
+    return size;
+}
+
+} // namespace detail
+} // namespace CPPandas
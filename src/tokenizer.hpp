@@ -0,0 +1,195 @@
+/**
+ * @file tokenizer.hpp
+ * @brief Tokenizador de CSV baseado em varredura vetorizada de caracteres estruturais
+ *
+ * Cabeçalho interno. Cada byte da entrada é lido uma única vez pelo kernel
+ * de varredura, que emite diretamente as posições dos delimitadores e
+ * quebras de linha que estão fora de aspas (RFC 4180). O tokenizador
+ * percorre apenas essas posições para montar os campos.
+ */
+
+#ifndef CPPANDAS_TOKENIZER_HPP
+#define CPPANDAS_TOKENIZER_HPP
+
+#include "simd.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace CPPandas {
+namespace detail {
+
+/**
+ * @brief Obtém o nível SIMD usado pelo kernel de varredura (detectado uma vez)
+ * @return Nível SIMD em uso
+ */
+SimdLevel scannerSimdLevel();
+
+/**
+ * @brief Estado do kernel de varredura entre chamadas consecutivas
+ *
+ * Uma aspa só abre um campo entre aspas quando é o primeiro byte do campo;
+ * no meio de um campo sem aspas ela é literal.
+ */
+struct ScanState {
+    bool inQuotes = false;   ///< Dentro de um campo entre aspas
+    bool fieldStart = true;  ///< Uma aspa no próximo byte alterna o estado (início de campo ou escape "")
+};
+
+/**
+ * @brief Localiza delimitadores e quebras de linha fora de aspas
+ *
+ * @param data Início dos dados
+ * @param length Número de bytes
+ * @param delimiter Caractere delimitador
+ * @param state Estado no início; atualizado com o estado ao final
+ * @param out Recebe as posições relativas a @p data; deve comportar length + 64 valores
+ * @param level Implementação a ser usada
+ * @return Número de posições emitidas
+ */
+size_t scanFieldBoundaries(const char* data, uint32_t length, char delimiter,
+                           ScanState& state, uint32_t* out, SimdLevel level);
+
+/**
+ * @brief Atualiza o estado de aspas sobre um trecho, sem emitir posições
+ *
+ * @param data Início dos dados
+ * @param length Número de bytes
+ * @param delimiter Caractere delimitador
+ * @param state Estado no início; atualizado com o estado ao final
+ * @param level Implementação a ser usada
+ */
+void scanQuoteState(const char* data, size_t length, char delimiter,
+                    ScanState& state, SimdLevel level);
+
+/**
+ * @brief Substitui aspas duplicadas ("") por aspas simples
+ * @param field Conteúdo de um campo entre aspas, sem as aspas externas
+ * @return Campo sem o escape
+ */
+std::string unescapeQuotes(std::string_view field);
+
+/**
+ * @brief Substitui aspas duplicadas ("") por aspas simples, escrevendo em um buffer
+ * @param field Conteúdo de um campo entre aspas, sem as aspas externas
+ * @param out Destino, com espaço para field.size() caracteres
+ * @return Número de caracteres escritos
+ */
+size_t unescapeQuotes(std::string_view field, char* out);
+
+/**
+ * @brief Tamanho máximo da janela processada por chamada ao kernel de varredura
+ */
+constexpr uint32_t kScanWindow = 256 * 1024;
+
+/**
+ * @brief Tamanho da primeira janela de cada chamada a tokenize()
+ *
+ * As janelas dobram até kScanWindow: leituras que param após poucas linhas
+ * (cabeçalho, lotes pequenos) não varrem 256 KB à frente.
+ */
+constexpr uint32_t kFirstScanWindow = 1024;
+
+/**
+ * @brief Divide um bloco de CSV em campos e linhas
+ *
+ * Para cada campo, chama onField(conteúdo, temEscape), em que o conteúdo
+ * já não contém as aspas externas e temEscape indica aspas duplicadas
+ * que precisam de unescapeQuotes(). Ao fim de cada linha não vazia, chama
+ * onRowEnd(), que retorna false para interromper a leitura.
+ *
+ * Em leituras incrementais, @p finalBlock = false indica que o bloco pode
+ * terminar no meio de uma linha: a linha incompleta não é finalizada e a
+ * posição retornada é o seu início, de onde a leitura deve recomeçar.
+ *
+ * @param begin Início do bloco (início de uma linha, fora de aspas)
+ * @param end Fim do bloco
+ * @param delimiter Caractere delimitador
+ * @param onField Função chamada para cada campo
+ * @param onRowEnd Função chamada ao fim de cada linha
+ * @param finalBlock Se o bloco termina junto com os dados
+ * @param positions Buffer de trabalho das posições, reaproveitado entre chamadas
+ * @return Posição logo após a última linha processada
+ */
+template <typename OnField, typename OnRowEnd>
+const char* tokenize(const char* begin, const char* end, char delimiter,
+                     OnField&& onField, OnRowEnd&& onRowEnd, bool finalBlock,
+                     std::vector<uint32_t>& positions) {
+    static const SimdLevel level = scannerSimdLevel();
+
+    auto emitField = [&](const char* fieldStart, const char* fieldEnd) {
+        std::string_view field(fieldStart, fieldEnd - fieldStart);
+        if (field.size() >= 2 && field.front() == '"' && field.back() == '"') {
+            field = field.substr(1, field.size() - 2);
+            onField(field, field.find('"') != std::string_view::npos);
+        } else {
+            onField(field, false);
+        }
+    };
+
+    const char* fieldStart = begin;
+    const char* rowStart = begin;
+    size_t fieldsInRow = 0;
+    ScanState state;
+
+    uint32_t windowSize = kFirstScanWindow;
+    for (const char* window = begin; window < end; window += windowSize, windowSize = std::min(windowSize * 2, kScanWindow)) {
+        uint32_t length = static_cast<uint32_t>(std::min<size_t>(windowSize, end - window));
+        if (positions.size() < static_cast<size_t>(length) + 64) {
+            positions.resize(static_cast<size_t>(length) + 64);
+        }
+        size_t count = scanFieldBoundaries(window, length, delimiter, state, positions.data(), level);
+
+        for (size_t k = 0; k < count; ++k) {
+            const char* position = window + positions[k];
+            if (*position == delimiter) {
+                emitField(fieldStart, position);
+                fieldsInRow++;
+            } else if (position > fieldStart || fieldsInRow > 0) {
+                // Fim de uma linha com conteúdo
+                emitField(fieldStart, position);
+                fieldsInRow = 0;
+                if (!onRowEnd()) {
+                    return position + 1;
+                }
+            }
+            // Linhas vazias e o '\n' de um "\r\n" não geram campos
+            fieldStart = position + 1;
+            if (fieldsInRow == 0) {
+                rowStart = fieldStart;
+            }
+        }
+    }
+
+    if (!finalBlock) {
+        return rowStart;
+    }
+
+    // Última linha sem quebra de linha final
+    if (fieldStart < end || fieldsInRow > 0) {
+        emitField(fieldStart, end);
+        onRowEnd();
+    }
+
+    return end;
+}
+
+/**
+ * @brief Divide um bloco de CSV em campos e linhas, com um buffer de trabalho próprio
+ */
+template <typename OnField, typename OnRowEnd>
+const char* tokenize(const char* begin, const char* end, char delimiter,
+                     OnField&& onField, OnRowEnd&& onRowEnd, bool finalBlock = true) {
+    std::vector<uint32_t> positions;
+    return tokenize(begin, end, delimiter, std::forward<OnField>(onField), std::forward<OnRowEnd>(onRowEnd),
+                    finalBlock, positions);
+}
+
+} // namespace detail
+} // namespace CPPandas
+
+#endif // CPPANDAS_TOKENIZER_HPP
@@ -0,0 +1,164 @@
+/**
+ * @file writer.cpp
+ * @brief Escrita de arquivos CSV em fluxo, com formatação em blocos de linhas (CSV::save)
+ */
+
+#include "cppandas/csv.hpp"
+#include "cppandas/thread_pool.hpp"
+#include <charconv>
+#include <cmath>
+#include <deque>
+#include <fstream>
+#include <future>
+
+namespace CPPandas {
+
+namespace {
+
+// Abaixo deste número de células, a escrita usa uma única thread
+constexpr size_t kParallelMinCells = 1 << 18;
+
+bool needsQuotes(std::string_view text, char delimiter) {
+    for (char c : text) {
+        if (c == delimiter || c == '"' || c == '\n' || c == '\r') {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Acrescenta um campo de texto, entre aspas se necessário (RFC 4180)
+void appendText(std::string& out, std::string_view text, char delimiter) {
+    if (!needsQuotes(text, delimiter)) {
+        out.append(text);
+        return;
+    }
+    out += '"';
+    for (char c : text) {
+        if (c == '"') {
+            out += '"';
+        }
+        out += c;
+    }
+    out += '"';
+}
+
+void appendNumber(std::string& out, int64_t value) {
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+// Acrescenta o valor de uma linha de uma coluna; nulos são campos vazios
+void appendCell(std::string& out, const ColumnBuffer& column, size_t row, char delimiter) {
+    switch (column.dtype()) {
+        case DType::Float64: {
+            double value = column.float64()[row];
+            if (!std::isnan(value)) {
+                char buffer[kFloat64TextSize];
+                out.append(buffer, formatFloat64(value, buffer));
+            }
+            break;
+        }
+        case DType::Int64:
+            appendNumber(out, column.int64()[row]);
+            break;
+        case DType::Bool:
+            out.append(column.boolean()[row] ? "True" : "False");
+            break;
+        case DType::Datetime: {
+            int64_t value = column.datetime()[row];
+            if (value != kNaT) {
+                char buffer[kDatetimeTextSize];
+                out.append(buffer, formatDatetime(value, buffer));
+            }
+            break;
+        }
+        case DType::String:
+            appendText(out, column.strings()[row], delimiter);
+            break;
+        case DType::Category: {
+            uint32_t code = column.code(row);
+            if (code != ColumnBuffer::kNullCode) {
+                appendText(out, column.categories()[code], delimiter);
+            }
+            break;
+        }
+    }
+}
+
+void formatRows(std::string& out, std::span<const ColumnBuffer> columns, size_t begin, size_t end,
+                char delimiter) {
+    for (size_t row = begin; row < end; ++row) {
+        for (size_t i = 0; i < columns.size(); ++i) {
+            if (i > 0) {
+                out += delimiter;
+            }
+            appendCell(out, columns[i], row, delimiter);
+        }
+        out += '\n';
+    }
+}
+
+} // namespace
+
+bool CSV::save(const std::string& filename, const WriteOptions& options) const {
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    const char delimiter = options.delimiter;
+    const size_t blockRows = std::max<size_t>(options.blockRows, 1);
+
+    std::string buffer;
+    if (options.header && !m_headers.empty()) {
+        for (size_t i = 0; i < m_headers.size(); ++i) {
+            if (i > 0) {
+                buffer += delimiter;
+            }
+            appendText(buffer, m_headers[i], delimiter);
+        }
+        buffer += '\n';
+        file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+
+    const size_t blockCount = (m_rowCount + blockRows - 1) / blockRows;
+    std::shared_ptr<ThreadPool> pool;
+    if (options.numThreads != 1 && blockCount > 1 && m_rowCount * m_columns.size() >= kParallelMinCells) {
+        pool = options.numThreads == 0 ? ThreadPool::global() : std::make_shared<ThreadPool>(options.numThreads);
+    }
+
+    if (!pool || pool->size() < 2) {
+        // Um único buffer, reaproveitado a cada bloco
+        for (size_t block = 0; block < blockCount && file; ++block) {
+            buffer.clear();
+            formatRows(buffer, m_columns, block * blockRows, std::min(m_rowCount, (block + 1) * blockRows), delimiter);
+            file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        }
+        return file.good();
+    }
+
+    // Os blocos são formatados no pool e gravados em ordem por esta thread;
+    // no máximo duas levas de blocos ficam em memória ao mesmo tempo
+    const size_t window = pool->size() * 2;
+    std::deque<std::future<std::string>> pending;
+    size_t nextBlock = 0;
+    while (nextBlock < blockCount || !pending.empty()) {
+        while (nextBlock < blockCount && pending.size() < window) {
+            size_t begin = nextBlock * blockRows;
+            size_t end = std::min(m_rowCount, begin + blockRows);
+            pending.push_back(pool->submit([this, begin, end, delimiter]() {
+                std::string text;
+                formatRows(text, m_columns, begin, end, delimiter);
+                return text;
+            }));
+            nextBlock++;
+        }
+        std::string text = pending.front().get();
+        pending.pop_front();
+        file.write(text.data(), static_cast<std::streamsize>(text.size()));
+    }
+    return file.good();
+}
+
+} // namespace CPPandas
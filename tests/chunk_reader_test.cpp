@@ -0,0 +1,125 @@
+/**
+ * @file chunk_reader_test.cpp
+ * @brief Testes dos tipos de coluna na leitura em lotes
+ */
+
+#include "cppandas/cppandas.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace CPPandas;
+
+namespace {
+
+int failures = 0;
+
+#define CHECK(condition)                                                        \
+    do {                                                                        \
+        if (!(condition)) {                                                     \
+            std::fprintf(stderr, "%s:%d: falhou: %s\n", __FILE__, __LINE__, #condition); \
+            failures++;                                                         \
+        }                                                                       \
+    } while (0)
+
+std::string tempPath(const std::string& name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+std::string writeFile(const std::string& name, const std::string& content) {
+    std::string path = tempPath(name);
+    std::ofstream(path, std::ios::binary) << content;
+    return path;
+}
+
+void testWidensInsteadOfDropping() {
+    // Um valor que não cabe no tipo dos lotes anteriores amplia a coluna
+    std::string path = writeFile("cppandas_chunk_widen.csv", "a\n1\n2\n3.5\nfoo\n");
+    CSV::ChunkReader reader(path, 2);
+    CSV batch;
+
+    CHECK(reader.next(batch));
+    CHECK(batch.column(0).dtype() == DType::Int64);
+    CHECK(reader.schema().dtype("a") == DType::Int64);
+
+    CHECK(reader.next(batch));
+    CHECK(batch.column(0).dtype() == DType::String);
+    CHECK(batch.getRow(0)[0] == "3.5");
+    CHECK(batch.getRow(1)[0] == "foo");
+    CHECK(reader.schema().dtype("a") == DType::String);
+
+    CHECK(!reader.next(batch));
+    std::filesystem::remove(path);
+}
+
+void testKeepsInt64WithoutNulls() {
+    // Inteiros acima de 2^53 só são promovidos se algum lote tiver nulos
+    std::string path = writeFile("cppandas_chunk_int64.csv", "id,v\n9007199254740993,1\n9007199254740995,\n7,2\n");
+    DataFrameChunkReader reader(path, 2);
+    DataFrame chunk;
+
+    CHECK(reader.next(chunk));
+    CHECK(reader.schema().dtype("id") == DType::Int64);
+    CHECK(reader.schema().dtype("v") == DType::Float64);
+    CHECK(reader.next(chunk));
+    CHECK(reader.schema().dtype("id") == DType::Int64);
+    CHECK(reader.schema().dtype("v") == DType::Float64);
+    CHECK(reader.schema() == CPPandas::CPPandas::read_csv(path).schema());
+    std::filesystem::remove(path);
+}
+
+void testBatchesMatchFullLoad() {
+    // Campos entre aspas com quebras de linha, aspas literais e linhas
+    // irregulares, em um arquivo maior que o buffer de leitura do leitor
+    std::string path = tempPath("cppandas_chunk_full.csv");
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "a,b,c,d\n";
+        for (int i = 0; i < 300000; ++i) {
+            switch (i % 3) {
+                case 0: file << "\"x,\n\"\"y\"\"\"," << i << ",z\n"; break;
+                case 1: file << "p,12\" long," << i << ",w,extra\n"; break;
+                default: file << "n," << i << "\n"; break;
+            }
+        }
+    }
+
+    for (bool projected : {false, true}) {
+        ReadOptions options;
+        if (projected) {
+            options.usecols = {"b", "d"};
+        }
+        CSV full(path, options);
+        for (size_t chunkSize : {size_t(7), size_t(100000)}) {
+            CSV::ChunkReader reader(path, chunkSize, options);
+            CSV batch;
+            size_t row = 0;
+            bool same = true;
+            while (reader.next(batch)) {
+                for (size_t i = 0; i < batch.rowCount() && same; ++i) {
+                    same = batch.getRow(i) == full.getRow(row + i);
+                }
+                row += batch.rowCount();
+            }
+            CHECK(same);
+            CHECK(row == full.rowCount());
+        }
+    }
+    std::filesystem::remove(path);
+}
+
+} // namespace
+
+int main() {
+    testWidensInsteadOfDropping();
+    testKeepsInt64WithoutNulls();
+    testBatchesMatchFullLoad();
+
+    if (failures > 0) {
+        std::fprintf(stderr, "%d verificação(ões) falharam\n", failures);
+        return 1;
+    }
+    std::printf("chunk_reader_test: ok\n");
+    return 0;
+}
@@ -0,0 +1,133 @@
+/**
+ * @file reduce_test.cpp
+ * @brief Testes dos kernels de redução com NaN e infinitos
+ *
+ * As implementações escalar, AVX2 e AVX-512 (quando suportadas pela CPU)
+ * devem produzir a mesma contagem, mínimo, máximo, soma, média e variância.
+ */
+
+#include "cppandas/reduce.hpp"
+#include "simd.hpp"
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+namespace CPPandas {
+namespace detail {
+
+// Definido em reduce.cpp, exposto para comparar as implementações
+Reduction reduceFloat64(std::span<const double> values, double shift, SimdLevel level);
+
+} // namespace detail
+} // namespace CPPandas
+
+using namespace CPPandas;
+using namespace CPPandas::detail;
+
+namespace {
+
+int failures = 0;
+
+#define CHECK(condition)                                                        \
+    do {                                                                        \
+        if (!(condition)) {                                                     \
+            std::fprintf(stderr, "%s:%d: falhou: %s\n", __FILE__, __LINE__, #condition); \
+            failures++;                                                         \
+        }                                                                       \
+    } while (0)
+
+constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+// Níveis suportados pela CPU atual
+std::vector<SimdLevel> availableLevels() {
+    std::vector<SimdLevel> levels{SimdLevel::Scalar};
+    SimdLevel best = detectSimdLevel();
+    if (best >= SimdLevel::AVX2) levels.push_back(SimdLevel::AVX2);
+    if (best >= SimdLevel::AVX512) levels.push_back(SimdLevel::AVX512);
+    return levels;
+}
+
+// Igualdade em que NaN == NaN; somas podem diferir pela ordem de acumulação
+bool same(double a, double b) {
+    if (std::isnan(a) || std::isnan(b)) {
+        return std::isnan(a) && std::isnan(b);
+    }
+    if (std::isinf(a) || std::isinf(b)) {
+        return a == b;
+    }
+    return std::fabs(a - b) <= 1e-9 * std::max(1.0, std::fabs(a));
+}
+
+struct Expected {
+    size_t count;
+    double sum;
+    double mean;
+    double variance;
+    double min;
+    double max;
+};
+
+// Cada caso é repetido em posições diferentes, para passar pelos laços
+// vetoriais e pelo resto escalar/mascarado
+void checkAllLevels(const std::vector<double>& values, const Expected& expected) {
+    for (size_t padding : {size_t(0), size_t(5), size_t(16), size_t(37)}) {
+        std::vector<double> padded(padding, kNaN);
+        padded.insert(padded.end(), values.begin(), values.end());
+        double shift = 0.0;
+        for (double value : padded) {
+            if (!std::isnan(value)) {
+                shift = std::isfinite(value) ? value : 0.0;
+                break;
+            }
+        }
+        for (SimdLevel level : availableLevels()) {
+            Reduction r = reduceFloat64(padded, shift, level);
+            CHECK(r.count == expected.count);
+            CHECK(same(r.sum(), expected.sum));
+            CHECK(same(r.mean(), expected.mean));
+            CHECK(same(r.variance(), expected.variance));
+            CHECK(same(r.min, expected.min));
+            CHECK(same(r.max, expected.max));
+        }
+    }
+}
+
+void testFinite() {
+    checkAllLevels({1, 2, kNaN, 3, 4, 5, 6, 7, 8, 9, 10}, {10, 55, 5.5, 55.0 / 6.0, 1, 10});
+}
+
+void testPositiveInfinity() {
+    checkAllLevels({1, kInf, 1}, {3, kInf, kInf, kNaN, 1, kInf});
+    checkAllLevels({1, 2, 3, 4, 5, 6, 7, kInf, kNaN, 9, 10}, {10, kInf, kInf, kNaN, 1, kInf});
+}
+
+void testNegativeInfinity() {
+    checkAllLevels({-kInf, 1, 2, 3, 4, 5, 6, 7, 8}, {9, -kInf, -kInf, kNaN, -kInf, 8});
+}
+
+void testBothInfinities() {
+    checkAllLevels({1, kInf, 2, 3, 4, 5, 6, 7, -kInf, kNaN}, {9, kNaN, kNaN, kNaN, -kInf, kInf});
+}
+
+void testOnlyNaN() {
+    checkAllLevels({kNaN, kNaN, kNaN}, {0, 0.0, kNaN, kNaN, kNaN, kNaN});
+}
+
+} // namespace
+
+int main() {
+    testFinite();
+    testPositiveInfinity();
+    testNegativeInfinity();
+    testBothInfinities();
+    testOnlyNaN();
+
+    if (failures > 0) {
+        std::fprintf(stderr, "%d verificação(ões) falharam\n", failures);
+        return 1;
+    }
+    std::printf("reduce_test: ok\n");
+    return 0;
+}
@@ -0,0 +1,217 @@
+/**
+ * @file tokenizer_test.cpp
+ * @brief Testes do kernel de varredura e do tokenizador de CSV
+ *
+ * As implementações escalar, SSE2 e AVX2 (quando suportadas pela CPU) devem
+ * emitir exatamente as mesmas posições e terminar no mesmo estado de aspas.
+ */
+
+#include "tokenizer.hpp"
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace CPPandas;
+using namespace CPPandas::detail;
+
+namespace {
+
+int failures = 0;
+
+#define CHECK(condition)                                                        \
+    do {                                                                        \
+        if (!(condition)) {                                                     \
+            std::fprintf(stderr, "%s:%d: falhou: %s\n", __FILE__, __LINE__, #condition); \
+            failures++;                                                         \
+        }                                                                       \
+    } while (0)
+
+using Rows = std::vector<std::vector<std::string>>;
+
+// Níveis suportados pela CPU atual
+std::vector<SimdLevel> availableLevels() {
+    std::vector<SimdLevel> levels{SimdLevel::Scalar};
+    SimdLevel best = detectSimdLevel();
+    if (best >= SimdLevel::SSE2) levels.push_back(SimdLevel::SSE2);
+    if (best >= SimdLevel::AVX2) levels.push_back(SimdLevel::AVX2);
+    return levels;
+}
+
+struct ScanResult {
+    std::vector<uint32_t> positions;
+    ScanState state;
+};
+
+ScanResult scan(const std::string& text, SimdLevel level, char delimiter = ',') {
+    ScanResult result;
+    result.positions.resize(text.size() + 64);
+    size_t count = scanFieldBoundaries(text.data(), static_cast<uint32_t>(text.size()), delimiter,
+                                       result.state, result.positions.data(), level);
+    result.positions.resize(count);
+    return result;
+}
+
+// Campos e linhas produzidos pelo tokenizador, com o escape "" já removido
+Rows tokenizeAll(const std::string& text, char delimiter = ',') {
+    Rows rows(1);
+    tokenize(text.data(), text.data() + text.size(), delimiter,
+        [&rows](std::string_view field, bool escaped) {
+            rows.back().push_back(escaped ? unescapeQuotes(field) : std::string(field));
+        },
+        [&rows]() {
+            rows.emplace_back();
+            return true;
+        });
+    rows.pop_back();
+    return rows;
+}
+
+// Referência byte a byte: uma aspa só alterna o estado dentro de aspas ou
+// logo após um delimitador, uma quebra de linha ou outra aspa que alternou
+ScanResult scanReference(const std::string& text, char delimiter = ',') {
+    ScanResult result;
+    ScanState& state = result.state;
+    for (size_t i = 0; i < text.size(); ++i) {
+        char c = text[i];
+        if (c == '"') {
+            bool toggles = state.inQuotes || state.fieldStart;
+            if (toggles) {
+                state.inQuotes = !state.inQuotes;
+            }
+            state.fieldStart = toggles;
+        } else if (c == delimiter || c == '\n' || c == '\r') {
+            if (!state.inQuotes) {
+                result.positions.push_back(static_cast<uint32_t>(i));
+            }
+            state.fieldStart = true;
+        } else {
+            state.fieldStart = false;
+        }
+    }
+    return result;
+}
+
+// Todas as implementações devem concordar entre si e com a referência
+void checkLevelsAgree(const std::string& text) {
+    ScanResult reference = scanReference(text);
+    for (SimdLevel level : availableLevels()) {
+        ScanResult result = scan(text, level);
+        CHECK(result.positions == reference.positions);
+        CHECK(result.state.inQuotes == reference.state.inQuotes);
+        CHECK(result.state.fieldStart == reference.state.fieldStart);
+    }
+}
+
+void testSimpleRows() {
+    std::string text = "a,b,c\n1,2,3\n";
+    checkLevelsAgree(text);
+    CHECK(scan(text, SimdLevel::Scalar).positions == (std::vector<uint32_t>{1, 3, 5, 7, 9, 11}));
+    CHECK(tokenizeAll(text) == (Rows{{"a", "b", "c"}, {"1", "2", "3"}}));
+}
+
+void testQuotedDelimitersAndNewlines() {
+    std::string text = "\"a,b\",\"line\nbreak\",c\n";
+    checkLevelsAgree(text);
+    CHECK(tokenizeAll(text) == (Rows{{"a,b", "line\nbreak", "c"}}));
+}
+
+void testEscapedQuotes() {
+    std::string text = "\"say \"\"hi\"\"\",\"\"\"\",x\n";
+    checkLevelsAgree(text);
+    CHECK(tokenizeAll(text) == (Rows{{"say \"hi\"", "\"", "x"}}));
+}
+
+void testMidFieldQuote() {
+    // Uma aspa fora do início do campo é literal
+    std::string text = "pipe,12\" long,3\nbolt,1/2,4\nnut,3/8,5\n";
+    checkLevelsAgree(text);
+    CHECK(tokenizeAll(text) == (Rows{{"pipe", "12\" long", "3"}, {"bolt", "1/2", "4"}, {"nut", "3/8", "5"}}));
+    ScanResult result = scan(text, SimdLevel::Scalar);
+    CHECK(!result.state.inQuotes);
+
+    std::string pair = "a\"b\"c,d\n";
+    checkLevelsAgree(pair);
+    CHECK(tokenizeAll(pair) == (Rows{{"a\"b\"c", "d"}}));
+}
+
+void testCRLF() {
+    std::string text = "a,\"b\r\nc\"\r\n1,2\r\n";
+    checkLevelsAgree(text);
+    CHECK(tokenizeAll(text) == (Rows{{"a", "b\r\nc"}, {"1", "2"}}));
+}
+
+void testMissingFinalNewline() {
+    std::string text = "a,b\n1,\"2\"";
+    checkLevelsAgree(text);
+    CHECK(tokenizeAll(text) == (Rows{{"a", "b"}, {"1", "2"}}));
+}
+
+void testFieldsAcrossBlocks() {
+    // Campo sem aspas, campo entre aspas e escape "" atravessando o limite de 64 bytes
+    std::string plain(70, 'x');
+    std::string quoted = "\"" + std::string(60, 'q') + ",\n" + std::string(10, 'q') + "\"";
+    std::string text = plain + "," + quoted + "\n";
+    checkLevelsAgree(text);
+    CHECK(tokenizeAll(text) == (Rows{{plain, quoted.substr(1, quoted.size() - 2)}}));
+
+    // As aspas do escape ficam nos bytes 63 e 64
+    std::string escaped = "\"" + std::string(61, 'e') + "\"\"" + std::string(5, 'e') + "\",z\n";
+    checkLevelsAgree(escaped);
+    CHECK(tokenizeAll(escaped) == (Rows{{std::string(61, 'e') + "\"" + std::string(5, 'e'), "z"}}));
+
+    // Aspa literal no byte 64, logo após o fim de um bloco
+    std::string literal = std::string(64, 'l') + "\"in\",next\n1,2\n";
+    checkLevelsAgree(literal);
+    CHECK(tokenizeAll(literal) == (Rows{{std::string(64, 'l') + "\"in\"", "next"}, {"1", "2"}}));
+}
+
+void testSplitScan() {
+    // Varrer em dois trechos deve produzir o mesmo estado final que em um só
+    std::string text = "a,\"b\nc\"\"d\",e\"f\n\"g\",h,\"i,j\"\n" + std::string(100, 'k') + ",\"l\"\n";
+    for (SimdLevel level : availableLevels()) {
+        ScanState whole;
+        scanQuoteState(text.data(), text.size(), ',', whole, level);
+        for (size_t split = 0; split <= text.size(); ++split) {
+            ScanState state;
+            scanQuoteState(text.data(), split, ',', state, level);
+            scanQuoteState(text.data() + split, text.size() - split, ',', state, level);
+            CHECK(state.inQuotes == whole.inQuotes);
+            CHECK(state.fieldStart == whole.fieldStart);
+        }
+    }
+}
+
+void testRandomInputs() {
+    // Entradas aleatórias com muitos caracteres estruturais e aspas
+    std::mt19937 random(42);
+    const char alphabet[] = {'a', 'b', ',', '"', '"', '\n', '\r', ' '};
+    for (int round = 0; round < 500; ++round) {
+        std::string text(random() % 400, ' ');
+        for (char& c : text) {
+            c = alphabet[random() % sizeof(alphabet)];
+        }
+        checkLevelsAgree(text);
+    }
+}
+
+} // namespace
+
+int main() {
+    testSimpleRows();
+    testQuotedDelimitersAndNewlines();
+    testEscapedQuotes();
+    testMidFieldQuote();
+    testCRLF();
+    testMissingFinalNewline();
+    testFieldsAcrossBlocks();
+    testSplitScan();
+    testRandomInputs();
+
+    if (failures > 0) {
+        std::fprintf(stderr, "%d verificação(ões) falharam\n", failures);
+        return 1;
+    }
+    std::printf("tokenizer_test: ok\n");
+    return 0;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file writer_test.cpp
+ * @brief Testes de ida e volta da escrita de CSV (tipos e texto)
+ */
+
+#include "cppandas/cppandas.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace CPPandas;
+
+namespace {
+
+int failures = 0;
+
+#define CHECK(condition)                                                        \
+    do {                                                                        \
+        if (!(condition)) {                                                     \
+            std::fprintf(stderr, "%s:%d: falhou: %s\n", __FILE__, __LINE__, #condition); \
+            failures++;                                                         \
+        }                                                                       \
+    } while (0)
+
+std::string tempPath(const std::string& name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+std::string readText(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream text;
+    text << file.rdbuf();
+    return text.str();
+}
+
+void testIntegralFloatsStayFloat() {
+    // Valores float64 inteiros são escritos com ".0" e relidos como float64
+    std::string source = tempPath("cppandas_writer_source.csv");
+    std::string saved = tempPath("cppandas_writer_saved.csv");
+    std::ofstream(source, std::ios::binary) << "x,y,n\n7.0,0.5,1\n8.0,1e300,2\n-3.0,,3\n";
+
+    DataFrame df = CPPandas::CPPandas::read_csv(source);
+    CHECK(df.schema().dtype("x") == DType::Float64);
+    CHECK(df.save(saved));
+    CHECK(readText(saved) == "x,y,n\n7.0,0.5,1\n8.0,1e+300,2\n-3.0,,3\n");
+
+    DataFrame reloaded = CPPandas::CPPandas::read_csv(saved);
+    CHECK(reloaded.schema() == df.schema());
+    CHECK(reloaded.column("x").float64()[0] == 7.0);
+    CHECK(reloaded.column("y").float64()[1] == 1e300);
+
+    std::filesystem::remove(source);
+    std::filesystem::remove(saved);
+}
+
+} // namespace
+
+int main() {
+    testIntegralFloatsStayFloat();
+
+    if (failures > 0) {
+        std::fprintf(stderr, "%d verificação(ões) falharam\n", failures);
+        return 1;
+    }
+    std::printf("writer_test: ok\n");
+    return 0;
+}